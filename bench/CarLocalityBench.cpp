@@ -0,0 +1,144 @@
+#include "config.hpp"
+#include "core/EntityManager.hpp"
+#include "core/EventBus.hpp"
+#include "core/Logger.hpp"
+#include "entities/Car.hpp"
+#include "entities/map/World.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <random>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @file CarLocalityBench.cpp
+ * @brief Compares car updates with car storage in spawn order and in Morton order.
+ *
+ * Usage: car_locality_bench [ticks]
+ * The scene is a crowded lot of cars manoeuvring off the main road, so every update runs the
+ * grid-based avoidance over its neighbours. Cars are spawned in random order, which scatters
+ * map neighbours over the heap. The second run re-sorts storage along the Z-order curve
+ * (EntityManager::reorderCars). On Linux, hardware cache misses are counted as well
+ * (perf_event_open; reported as n/a where counters are not available).
+ */
+
+namespace {
+constexpr float LOT_SIZE = 1500.0f; // Meters
+constexpr int CAR_COUNT = 40000;    // Far more car data than fits in cache
+constexpr int WARMUP_TICKS = 60;
+
+/// Hardware cache-miss counter for this thread, if the platform provides one.
+class CacheMissCounter {
+public:
+  CacheMissCounter() {
+#ifdef __linux__
+    perf_event_attr attr{};
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_CACHE_MISSES;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    fd = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+#endif
+  }
+  ~CacheMissCounter() {
+#ifdef __linux__
+    if (fd >= 0)
+      close(fd);
+#endif
+  }
+
+  bool isAvailable() const { return fd >= 0; }
+
+  void start() {
+#ifdef __linux__
+    if (fd >= 0) {
+      ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+      ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif
+  }
+
+  std::uint64_t stop() {
+    std::uint64_t count = 0;
+#ifdef __linux__
+    if (fd >= 0) {
+      ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+      if (read(fd, &count, sizeof(count)) != sizeof(count))
+        count = 0;
+    }
+#endif
+    return count;
+  }
+
+private:
+  int fd = -1;
+};
+
+struct Result {
+  double msPerTick;
+  double missesPerTick; ///< Negative when not measured
+};
+
+Result run(bool morton, int ticks) {
+  auto bus = std::make_shared<EventBus>();
+  EntityManager entities(bus);
+  entities.setWorld(std::make_unique<World>(LOT_SIZE, LOT_SIZE));
+  entities.setCarReorderInterval(morton ? Config::Render::CAR_REORDER_TICKS : 0);
+
+  // Same cars and paths in both runs, spawned in random order
+  std::mt19937 rng(1234);
+  std::uniform_real_distribution<float> coord(10.0f, LOT_SIZE - 10.0f);
+  std::uniform_real_distribution<float> hop(-30.0f, 30.0f);
+  const auto &phase = Config::CarAI::Phases::MANEUVER;
+  for (int i = 0; i < CAR_COUNT; ++i) {
+    Vector2 pos = {coord(rng), coord(rng)};
+    Vector2 target = {std::clamp(pos.x + hop(rng), 0.0f, LOT_SIZE), std::clamp(pos.y + hop(rng), 0.0f, LOT_SIZE)};
+    auto car = std::make_unique<Car>(pos, entities.getWorld(), Vector2{0, 0}, Car::CarType::COMBUSTION);
+    car->setPath(std::vector<Waypoint>{Waypoint(target, phase.tolerance, -1, 0.0f, false, phase.speedFactor)});
+    entities.addCar(std::move(car));
+  }
+  if (morton)
+    entities.reorderCars();
+
+  for (int i = 0; i < WARMUP_TICKS; ++i)
+    entities.update(Config::FIXED_DELTA_TIME);
+
+  CacheMissCounter misses;
+  misses.start();
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < ticks; ++i)
+    entities.update(Config::FIXED_DELTA_TIME);
+  auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+  std::uint64_t missCount = misses.stop();
+
+  return {elapsed / ticks, misses.isAvailable() ? (double)missCount / ticks : -1.0};
+}
+} // namespace
+
+int main(int argc, char **argv) {
+  int ticks = argc > 1 ? std::max(1, std::atoi(argv[1])) : 120;
+  SetTraceLogLevel(LOG_WARNING);
+
+  Result spawn = run(false, ticks);
+  Result morton = run(true, ticks);
+
+  Logger::Info("Spawn order:  {:.4f} ms/tick", spawn.msPerTick);
+  Logger::Info("Morton order: {:.4f} ms/tick", morton.msPerTick);
+  Logger::Info("Saving:       {:.1f}%", 100.0 * (1.0 - morton.msPerTick / spawn.msPerTick));
+  if (spawn.missesPerTick >= 0.0 && morton.missesPerTick >= 0.0) {
+    Logger::Info("Cache misses: {:.0f} -> {:.0f} per tick", spawn.missesPerTick, morton.missesPerTick);
+  } else {
+    Logger::Info("Cache misses: n/a (no hardware counters)");
+  }
+  return 0;
+}
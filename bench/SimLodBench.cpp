@@ -0,0 +1,117 @@
+#include "config.hpp"
+#include "core/EntityManager.hpp"
+#include "core/EventBus.hpp"
+#include "core/Logger.hpp"
+#include "entities/Car.hpp"
+#include "entities/map/Modules.hpp"
+#include "entities/map/World.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+
+/**
+ * @file SimLodBench.cpp
+ * @brief Times car updates in mixed traffic with and without the simulation level of detail.
+ *
+ * Usage: sim_lod_bench [ticks]
+ * The scene is a long main road with isolated cars, dense platoons on both lanes and cars
+ * manoeuvring slowly off the road (always full rate). Both runs simulate the same scene from scratch.
+ */
+
+namespace {
+constexpr int ROAD_MODULES = 60;
+constexpr int ISOLATED_PER_LANE = 24;  // 50m apart
+constexpr int PLATOONS_PER_LANE = 4;
+constexpr int PLATOON_SIZE = 8;        // 9m apart, well inside each other's headway
+constexpr int MANOEUVRING = 12;
+constexpr int WARMUP_TICKS = 120;
+
+struct Result {
+  double msPerTick;
+  std::size_t cruising;
+  std::size_t moving;
+  std::uint64_t stateHash; ///< Compare across builds (PARKLOGIC_DETERMINISTIC) to check a run reproduces
+};
+
+Result run(bool lod, int ticks) {
+  Car::SetSimLodEnabled(lod);
+  auto bus = std::make_shared<EventBus>();
+  EntityManager entities(bus);
+
+  float roadLength = 0.0f;
+  float roadY = 100.0f;
+  for (int i = 0; i < ROAD_MODULES; ++i) {
+    auto road = std::make_unique<NormalRoad>();
+    road->worldPosition = {roadLength, roadY};
+    roadLength += road->getWidth();
+    entities.addModule(std::move(road));
+  }
+  entities.setWorld(std::make_unique<World>(roadLength, 300.0f));
+
+  const float pixelsPerMeter = static_cast<float>(Config::ART_PIXELS_PER_METER);
+  const float downY = roadY + Config::LANE_OFFSET_DOWN / pixelsPerMeter;
+  const float upY = roadY + Config::LANE_OFFSET_UP / pixelsPerMeter;
+  const float speed = 15.0f;
+
+  auto addCar = [&entities](Vector2 pos, Vector2 vel, Waypoint target) {
+    auto car = std::make_unique<Car>(pos, entities.getWorld(), vel, Car::CarType::COMBUSTION);
+    car->setPath(std::vector<Waypoint>{target});
+    entities.addCar(std::move(car));
+  };
+
+  // Per lane: isolated cars first, then platoons further along; everyone stays on the road
+  // for the whole run (about 500m of travel at 1800 ticks)
+  Waypoint downEnd({roadLength + 2.0f, downY}, 10.0f, -1, 0.0f, true);
+  Waypoint upEnd({-2.0f, upY}, 10.0f, -1, 0.0f, true);
+  auto addBothLanes = [&](float offset) {
+    addCar({offset, downY}, {speed, 0}, downEnd);
+    addCar({roadLength - offset, upY}, {-speed, 0}, upEnd);
+  };
+  for (int i = 0; i < ISOLATED_PER_LANE; ++i)
+    addBothLanes(50.0f * i);
+  for (int p = 0; p < PLATOONS_PER_LANE; ++p) {
+    for (int c = 0; c < PLATOON_SIZE; ++c)
+      addBothLanes(1300.0f + 150.0f * p - 9.0f * c);
+  }
+
+  const auto &phase = Config::CarAI::Phases::MANEUVER;
+  for (int i = 0; i < MANOEUVRING; ++i) {
+    float x = roadLength * i / MANOEUVRING;
+    addCar({x, 30.0f}, {0, 0}, Waypoint({x + 20.0f, 250.0f}, phase.tolerance, -1, 0.0f, true, phase.speedFactor));
+  }
+
+  for (int i = 0; i < WARMUP_TICKS; ++i)
+    entities.update(Config::FIXED_DELTA_TIME);
+
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < ticks; ++i)
+    entities.update(Config::FIXED_DELTA_TIME);
+  auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+  Result result{elapsed / ticks, 0, 0, entities.stateHash()};
+  for (const auto &car : entities.getCars()) {
+    if (car->getState() == Car::CarState::PARKED)
+      continue;
+    result.moving++;
+    if (car->getSimLod() == Car::SimLod::CRUISE)
+      result.cruising++;
+  }
+  return result;
+}
+} // namespace
+
+int main(int argc, char **argv) {
+  int ticks = argc > 1 ? std::max(1, std::atoi(argv[1])) : 1800;
+  SetTraceLogLevel(LOG_WARNING);
+
+  Result full = run(false, ticks);
+  Result lod = run(true, ticks);
+
+  Logger::Info("Full rate:  {:.4f} ms/tick ({} moving cars)", full.msPerTick, full.moving);
+  Logger::Info("Sim LOD:    {:.4f} ms/tick ({} of {} cruising at the end)", lod.msPerTick, lod.cruising, lod.moving);
+  Logger::Info("Saving:     {:.1f}%", 100.0 * (1.0 - lod.msPerTick / full.msPerTick));
+  Logger::Info("State hash: {:016x} (full rate), {:016x} (sim LOD)", full.stateHash, lod.stateHash);
+  return 0;
+}
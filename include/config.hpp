@@ -26,31 +26,106 @@ constexpr int LANE_OFFSET_DOWN = 94; ///< Down lane offset from top of road (art
 constexpr int INITIAL_WINDOW_WIDTH = 1280; ///< Initial window width
 constexpr int INITIAL_WINDOW_HEIGHT = 720; ///< Initial window height
 
-constexpr int TICK_RATE = 60;                                             ///< Fixed update rate (ticks per second)
+constexpr int TICK_RATE = 60; ///< Fixed update rate (ticks per second); frames interpolate between ticks
 constexpr double FIXED_DELTA_TIME = 1.0 / static_cast<double>(TICK_RATE); ///< Time per tick
 
 constexpr int TARGET_FPS = 60;       ///< Target frames per second
 constexpr bool VSYNC_ENABLED = true; ///< Vertical sync flag
 
+constexpr const char *ASSET_PACK_PATH = "assets.pack"; ///< Pre-decoded textures written by asset_packer
+constexpr const char *WORLD_SNAPSHOT_PATH = "world.snapshot"; ///< Saved with F5 in game, offered by the map config screen
+constexpr const char *SYSTEM_GRAPH_PATH = "systems.dot"; ///< System dependency graph (Graphviz), written with F6 in game
+
+// System rates (Hz); SystemScheduler rounds them to whole ticks and staggers the slow ones
+namespace Schedule {
+constexpr double PHYSICS_HZ = TICK_RATE;   ///< Car kinematics and avoidance
+constexpr double TRAFFIC_HZ = TICK_RATE;   ///< Through-traffic flow, spot arrivals, removal of cars that left
+constexpr double SPAWNER_HZ = 10.0;        ///< Auto-spawn timer and background flow demand
+constexpr double PARKING_HZ = 1.0;         ///< Parking countdowns, charging and exit decisions
+constexpr double STATISTICS_HZ = 0.2;      ///< Occupancy statistics (OccupancyStatsEvent)
+} // namespace Schedule
+
+namespace Render {
+constexpr int STATIC_CHUNK_SIZE = 512; ///< Side of a baked static-layer chunk (texels)
+constexpr float STATIC_LAYER_PPM = static_cast<float>(ART_PIXELS_PER_METER); ///< Bake resolution: 1 texel per art pixel
+constexpr int MAX_RESIDENT_CHUNKS = 96; ///< Baked chunks kept in VRAM before off-screen ones are evicted (~1 MB each)
+constexpr float MODULE_GRID_CELL = 64.0f; ///< Cell size of the module lookup grid (Meters)
+constexpr float CAR_GRID_CELL = 16.0f;    ///< Cell size of the car lookup grid (Meters)
+constexpr int CAR_REORDER_TICKS = 300;    ///< Car storage is re-sorted along a Morton curve this often (0: never)
+
+// Level of detail, by camera zoom (1.0 = default view)
+constexpr float LOD_MID_ZOOM = 0.6f;  ///< Below this: path debug drawn as plain lines
+constexpr float LOD_FAR_ZOOM = 0.25f; ///< Below this: cars as points, facilities tinted by occupancy, no grid
+constexpr float LOD_CAR_POINT_SIZE = 2.5f; ///< Side of a far-LOD car point (Meters)
+
+// On-demand rendering: frames are only redrawn after something changed (see RedrawTracker)
+constexpr bool ON_DEMAND_RENDERING = true; ///< False: redraw every frame
+constexpr int REDRAW_SETTLE_FRAMES = 3;    ///< Frames rendered after the last change before going idle
+constexpr double IDLE_POLL_INTERVAL = 1.0 / TARGET_FPS; ///< Sleep between input polls while idle (Seconds)
+} // namespace Render
+
+namespace Audio {
+constexpr const char *MUSIC_PATH = "assets/background_music.mp3"; ///< Looping background music
+constexpr const char *CLICK_SOUND_PATH = "assets/click_sound.mp3"; ///< UI button click
+constexpr float MASTER_VOLUME = 0.5f; ///< Master volume when not muted
+constexpr float MUSIC_VOLUME = 0.1f;  ///< Background music level
+constexpr float CLICK_VOLUME = 0.3f;  ///< Button click level
+constexpr int FEED_INTERVAL_MS = 10;  ///< Audio thread wake-up period for music buffering
+} // namespace Audio
+
 namespace CarAI {
 /**
  * @struct AIPhase
  * @brief Parameters for car behavior during different navigation phases.
  */
 struct AIPhase {
-  float speedFactor;    ///< Multiplier of max speed (0.0 to 1.0).
-  float tolerance;      ///< Distance to waypoint to consider it "reached".
-  float correctionStep; ///< Distance interval for path smoothing.
+  float speedFactor; ///< Multiplier of max speed (0.0 to 1.0).
+  float tolerance;   ///< Distance to waypoint to consider it "reached"; also how far a turn may be cut.
 };
 
 namespace Phases {
-constexpr AIPhase HIGHWAY = {1.0f, 10.0f, 20.0f}; // Fast, loose, corrections every 15m
-constexpr AIPhase APPROACH = {1.0f, 3.0f, 5.0f};  // Approaches to facility
-constexpr AIPhase ACCESS = {0.4f, 4.0f, 3.0f};    // Entry roads / Connector
-constexpr AIPhase MANEUVER = {0.2f, 2.0f, 2.0f};  // Alignment / Interior
-constexpr AIPhase PARKING = {0.1f, 0.3f, 3.0f};   // Final spot (corrected back to user pref)
+constexpr AIPhase HIGHWAY = {1.0f, 10.0f}; // Fast, loose
+constexpr AIPhase APPROACH = {1.0f, 3.0f}; // Approaches to facility
+constexpr AIPhase ACCESS = {0.4f, 4.0f};   // Entry roads / Connector
+constexpr AIPhase MANEUVER = {0.2f, 2.0f}; // Alignment / Interior
+constexpr AIPhase PARKING = {0.1f, 0.3f};  // Final spot (corrected back to user pref)
 } // namespace Phases
 
+// Car footprint (the sprite's 17x31 art pixels)
+constexpr float CAR_WIDTH = 17.0f / ART_PIXELS_PER_METER;  // Meters, side to side
+constexpr float CAR_LENGTH = 31.0f / ART_PIXELS_PER_METER; // Meters, front to back
+
+// Pure pursuit: cars steer at a point this far ahead along their path
+constexpr float LOOKAHEAD_MIN = 2.0f;  // Meters, at standstill
+constexpr float LOOKAHEAD_TIME = 0.4f; // Seconds of travel added at speed
+constexpr float LOOKAHEAD_MAX = 10.0f; // Meters
+
+// Lane following on the main road (Intelligent Driver Model, leader from LaneQueues)
+namespace Lanes {
+constexpr float HALF_WIDTH = 1.0f;     // Meters from the lane line at which a car is in the lane
+constexpr float ACCELERATION = 6.0f;   // m/s^2, free-road acceleration
+constexpr float COMFORT_DECEL = 8.0f;  // m/s^2, braking the model aims for
+constexpr float MAX_DECEL = 40.0f;     // m/s^2, emergency cap
+constexpr float MIN_GAP = 1.5f;        // Meters, bumper to bumper at standstill
+constexpr float TIME_HEADWAY = 0.8f;   // Seconds of travel kept as gap
+} // namespace Lanes
+
+// Simulation level of detail: isolated cars cruising down a lane move in closed form until their horizon
+namespace SimLod {
+constexpr float MAX_CRUISE_TIME = 5.0f;    // Seconds between full updates of a cruising car, at most
+constexpr float ISOLATION_GAP = 40.0f;     // Meters to the nearest car in the lane (either way)
+constexpr float STEADY_ACCEL = 0.5f;       // m/s^2: net acceleration of a car at steady speed
+constexpr float CLEAR_AHEAD = 40.0f;       // Meters to the next waypoint (turns and junctions need full rate)
+} // namespace SimLod
+
+// Avoidance off the main road: footprints are checked as oriented boxes (SAT)
+namespace Avoidance {
+constexpr float CLEARANCE = 0.2f;             // Meters added on each side of the strip a car sweeps ahead
+constexpr float CRITICAL_GAP = 1.0f;          // Meters, bumper to obstacle, below which a car stops hard
+constexpr float SEPARATION_STIFFNESS = 30.0f; // Push per meter of overlap between footprints
+constexpr float MAX_SEPARATION = 30.0f;       // Push cap
+} // namespace Avoidance
+
 namespace GateDepth {
 // Distance (Meters) to drive "into" the facility before aligning
 constexpr float SMALL_PARKING = 12.0f;
@@ -66,6 +141,17 @@ constexpr float TURN_SLOWDOWN_ANGLE = 0.2f;    // Angle (radians) to consider "s
 constexpr float TURN_MIN_SPEED_FACTOR = 0.20f; // Slow down to at least this factor during turns
 } // namespace CarAI
 
+// Mesoscopic through-traffic on the main road (RoadFlow, cell transmission model)
+namespace Flow {
+constexpr float CELL_LENGTH = 20.0f; // Meters per cell, at most
+constexpr float FREE_SPEED = 15.0f;  // m/s, matches the cars' top speed
+constexpr float JAM_DENSITY = 1.0f / (CarAI::CAR_LENGTH + CarAI::Lanes::MIN_GAP); // Vehicles per meter
+constexpr float CAPACITY =
+    1.0f / (CarAI::Lanes::TIME_HEADWAY + (CarAI::CAR_LENGTH + CarAI::Lanes::MIN_GAP) / FREE_SPEED); // Veh/s
+// Background through-traffic per auto-spawn level in mesoscopic mode (vehicles per hour, both directions)
+constexpr float BACKGROUND_DEMAND[] = {0.0f, 1000.0f, 2500.0f, 5000.0f, 10000.0f, 20000.0f};
+} // namespace Flow
+
 // Battery Constants
 constexpr float BATTERY_LOW_THRESHOLD = 30.0f;
 constexpr float BATTERY_HIGH_THRESHOLD = 70.0f;
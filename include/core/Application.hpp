@@ -1,10 +1,14 @@
 #pragma once
+#include "core/AssetManager.hpp"
 #include "core/EventBus.hpp"
 #include "core/EventLogger.hpp"
 #include "core/GameLoop.hpp"
+#include "core/RedrawTracker.hpp"
+#include "core/ThreadPool.hpp"
 #include "core/Window.hpp"
 #include "input/InputSystem.hpp"
 #include "scenes/SceneManager.hpp"
+#include "systems/AudioSystem.hpp"
 #include "raylib.h"
 #include <memory>
 #include <vector>
@@ -50,24 +54,29 @@ private:
 
   /**
    * @brief Renders the current frame.
+   *
+   * @param alpha Fraction of a tick elapsed since the last update (interpolation factor).
    */
-  void render();
+  void render(double alpha);
   void DrawVolumeIcon(Vector2 pos, bool muted);
 
   std::shared_ptr<EventBus> eventBus;         ///< The central event bus for communication.
   std::unique_ptr<Window> window;             ///< The main game window.
   std::unique_ptr<GameLoop> gameLoop;         ///< The game loop manager.
+  std::unique_ptr<ThreadPool> threadPool;     ///< Workers for CPU jobs (asset decoding, world generation).
   std::unique_ptr<InputSystem> inputSystem;   ///< The input handling system.
   std::unique_ptr<SceneManager> sceneManager; ///< The scene manager.
   std::unique_ptr<EventLogger> eventLogger; ///< Logger for debugging events.
+  std::unique_ptr<RedrawTracker> redrawTracker; ///< Skips rendering while nothing changes.
 
   bool isRunning = true; ///< Flag indicating if the application is running.
   Subscription closeEventToken;          ///< Token for the window close event subscription.
   std::vector<Subscription> eventTokens; ///< Tokens for other event subscriptions.
   
-  Music backgroundMusic;
-  bool musicLoaded = false;
+  std::unique_ptr<AudioSystem> audioSystem; ///< Music and sound effects (own thread).
   bool isMuted = false;
+  TextureHandle soundOnIcon = INVALID_TEXTURE;
+  TextureHandle soundOffIcon = INVALID_TEXTURE;
   std::unique_ptr<UIButton> muteButton;
   
 };
@@ -1,7 +1,37 @@
 #pragma once
+#include "core/AssetManifest.hpp"
+#include "core/AssetPack.hpp"
 #include "raylib.h"
+#include <cstdint>
 #include <map>
+#include <span>
 #include <string>
+#include <vector>
+
+class ThreadPool;
+
+/**
+ * @brief Interned texture identifier: an index into AssetManager's flat texture array.
+ *
+ * Handle 0 is reserved for the empty texture, so an unset handle draws nothing.
+ */
+using TextureHandle = std::uint32_t;
+constexpr TextureHandle INVALID_TEXTURE = 0;
+
+/**
+ * @struct AssetLoadTiming
+ * @brief Startup report line for one image file loaded from the manifest.
+ */
+struct AssetLoadTiming {
+  std::string name;     ///< First manifest name using the file.
+  std::string path;     ///< Image file.
+  double decodeMs = 0;  ///< CPU decode time on a worker thread.
+  double uploadMs = 0;  ///< GPU upload time on the main thread.
+  int width = 0;        ///< Texture width (pixels).
+  int height = 0;       ///< Texture height (pixels).
+  bool loaded = false;  ///< False if the file could not be decoded or uploaded.
+  bool packed = false;  ///< Uploaded straight from the mounted asset pack (no decode).
+};
 
 /**
  * @file AssetManager.hpp
@@ -9,6 +39,10 @@
  *
  * Currently handles Textures and Sounds (placeholder).
  * Implements the Singleton pattern for global access.
+ *
+ * Texture names are interned into TextureHandles once (typically in constructors); the draw
+ * path then indexes a flat array instead of looking names up. A handle stays valid for the
+ * program's lifetime, even if requested before the texture is loaded or after it is unloaded.
  */
 class AssetManager {
 public:
@@ -25,6 +59,26 @@ public:
   AssetManager &operator=(const AssetManager &) = delete;
 
   // --- Textures ---
+  /**
+   * @brief Memory-maps a pre-decoded asset pack; LoadManifest then uploads from it.
+   * @param file Pack path (see AssetPack).
+   * @return False if there is no valid pack (textures are then decoded from their files).
+   */
+  bool MountPack(const std::string &file);
+
+  /**
+   * @brief Loads every texture of a manifest not loaded yet.
+   *
+   * Paths found in the mounted pack are uploaded straight from the mapping. The others are
+   * decoded once per distinct path, in parallel on the pool. GPU uploads run on the calling
+   * (main) thread. Logs a per-file timing report.
+   *
+   * @param entries Manifest entries (see AssetManifest::TEXTURES).
+   * @param pool Workers to decode the images on.
+   * @return One timing record per decoded file, in manifest order.
+   */
+  std::vector<AssetLoadTiming> LoadManifest(std::span<const AssetManifestEntry> entries, ThreadPool &pool);
+
   /**
    * @brief Loads a texture from disk and caches it.
    * @param name Unique string identifier for the asset.
@@ -33,7 +87,22 @@ public:
   void LoadTexture(const std::string &name, const std::string &path);
 
   /**
-   * @brief Retrieves a cached texture.
+   * @brief Resolves a texture name to its handle, reserving a slot if the name is new.
+   * @param name The unique identifier.
+   * @return Handle to pass to GetTexture(TextureHandle).
+   */
+  TextureHandle GetTextureHandle(const std::string &name);
+
+  /**
+   * @brief Retrieves a texture by handle (no string lookup).
+   * @return The texture, or an empty one (id 0) if the slot is not loaded.
+   */
+  const Texture2D &GetTexture(TextureHandle handle) const {
+    return handle < textureSlots.size() ? textureSlots[handle] : textureSlots[INVALID_TEXTURE];
+  }
+
+  /**
+   * @brief Retrieves a cached texture by name.
    * @param name The unique identifier.
    * @return The Raylib Texture2D object. Returns an empty/invalid texture if not found.
    */
@@ -52,9 +121,16 @@ public:
   void UnloadAll();
 
 private:
-  AssetManager() = default;
+  AssetManager();
   ~AssetManager();
 
-  std::map<std::string, Texture2D> textures;
+  /**
+   * @brief Empties a slot, unloading the GPU texture unless another name shares it.
+   */
+  void releaseSlot(TextureHandle handle);
+
+  std::map<std::string, TextureHandle> textureIds; ///< Name -> slot, only used when resolving
+  std::vector<Texture2D> textureSlots;             ///< Indexed by TextureHandle; slot 0 stays empty
   std::map<std::string, Sound> sounds;
+  AssetPack pack; ///< Pre-decoded textures, if a pack was mounted
 };
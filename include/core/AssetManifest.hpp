@@ -0,0 +1,61 @@
+#pragma once
+#include <string_view>
+
+/**
+ * @file AssetManifest.hpp
+ * @brief Declarative list of every texture the game loads at startup.
+ *
+ * Add new textures here rather than calling AssetManager::LoadTexture from constructors; code
+ * that draws them only resolves the name with AssetManager::GetTextureHandle. Entries sharing
+ * a path are decoded and uploaded once.
+ */
+
+/**
+ * @struct AssetManifestEntry
+ * @brief A texture name and the image file it is loaded from.
+ */
+struct AssetManifestEntry {
+  std::string_view name; ///< Name used with AssetManager::GetTextureHandle.
+  std::string_view path; ///< Image file, relative to the working directory.
+};
+
+namespace AssetManifest {
+inline constexpr AssetManifestEntry TEXTURES[] = {
+    // Menus
+    {"menu_bg", "assets/menu_background.png"},
+    {"config_bg", "assets/config_background.png"},
+    {"sound_on", "assets/sound_on.png"},
+    {"sound_off", "assets/volume-mute.png"},
+
+    // Background tiles
+    {"grass1", "assets/grass1.png"},
+    {"grass2", "assets/grass2.png"},
+    {"grass3", "assets/grass3.png"},
+    {"grass4", "assets/grass4.png"},
+
+    // Modules
+    {"road", "assets/road.png"},
+    {"entrance_up", "assets/entrance_up.png"},
+    {"entrance_down", "assets/entrance_down.png"},
+    {"entrance_double", "assets/entrance_double.png"},
+
+    {"parking_small_up", "assets/parking_small_up.png"},
+    {"parking_small_down", "assets/parking_small_down.png"},
+    {"parking_large_up", "assets/parking_large_up.png"},
+    {"parking_large_down", "assets/parking_large_down.png"},
+
+    {"charging_small_up", "assets/charging_small_up.png"},
+    {"charging_small_down", "assets/charging_small_down.png"},
+    {"charging_large_up", "assets/charging_large_up.png"},
+    {"charging_large_down", "assets/charging_large_down.png"},
+
+    // Cars (1x: combustion, 2x: electric)
+    {"car11", "assets/car11.png"},
+    {"car12", "assets/car12.png"},
+    {"car13", "assets/car13.png"},
+
+    {"car21", "assets/car21.png"},
+    {"car22", "assets/car22.png"},
+    {"car23", "assets/car23.png"},
+};
+} // namespace AssetManifest
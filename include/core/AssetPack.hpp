@@ -0,0 +1,112 @@
+#pragma once
+#include "core/MappedFile.hpp"
+#include "raylib.h"
+#include <cstdint>
+#include <map>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @file AssetPack.hpp
+ * @brief Single-file pack of pre-decoded textures, read through a memory mapping.
+ *
+ * Layout (little-endian): an AssetPackHeader, then entryCount AssetPackEntry records, then
+ * each entry's texel data at its offset (16-byte aligned). Texels are stored in the raylib
+ * pixel format recorded in the entry (the packer writes R8G8B8A8), so they are uploaded to
+ * the GPU straight from the mapping without any decoding.
+ *
+ * Packs are produced at build time by the asset_packer tool from AssetManifest::TEXTURES.
+ */
+
+/**
+ * @struct AssetPackHeader
+ * @brief First bytes of a pack file.
+ */
+struct AssetPackHeader {
+  char magic[4];           ///< "PLPK"
+  std::uint32_t version;   ///< AssetPack::VERSION
+  std::uint32_t entryCount;
+  std::uint32_t reserved;
+};
+
+/**
+ * @struct AssetPackEntry
+ * @brief Index record for one image.
+ */
+struct AssetPackEntry {
+  char path[96];         ///< Source path as listed in the manifest (zero padded).
+  std::uint32_t width;
+  std::uint32_t height;
+  std::uint32_t format;  ///< raylib PixelFormat.
+  std::uint32_t reserved;
+  std::uint64_t offset;  ///< Texel data offset from the start of the file.
+  std::uint64_t size;    ///< Texel data size in bytes.
+};
+
+static_assert(sizeof(AssetPackHeader) == 16, "pack header layout");
+static_assert(sizeof(AssetPackEntry) == 128, "pack entry layout");
+
+/**
+ * @class AssetPack
+ * @brief Reader (and writer) for asset pack files.
+ */
+class AssetPack {
+public:
+  static constexpr std::uint32_t VERSION = 1;
+  static constexpr std::size_t MAX_PATH_LENGTH = sizeof(AssetPackEntry::path) - 1;
+
+  /**
+   * @brief An image to be written into a pack.
+   */
+  struct Source {
+    std::string path;                   ///< Manifest path it replaces.
+    int width;
+    int height;
+    int format;                         ///< raylib PixelFormat of the texels.
+    std::span<const unsigned char> texels;
+  };
+
+  /**
+   * @brief Writes a pack file.
+   * @param file Output path.
+   * @param images Images to store, in index order.
+   * @return False if a path is too long or the file cannot be written.
+   */
+  static bool Write(const std::string &file, std::span<const Source> images);
+
+  /**
+   * @brief Maps a pack and validates its index.
+   * @param file Pack path.
+   * @return False if the file is missing, truncated or not a pack of this version.
+   */
+  bool open(const std::string &file);
+
+  void close();
+  bool isOpen() const { return data.isOpen(); }
+  std::size_t getEntryCount() const { return entries.size(); }
+
+  /**
+   * @brief Looks up an image by the path it was packed from.
+   * @return The entry, or nullptr if the pack does not contain it.
+   */
+  const AssetPackEntry *find(std::string_view path) const;
+
+  /**
+   * @brief Texel bytes of an entry, pointing into the mapping.
+   */
+  std::span<const unsigned char> texels(const AssetPackEntry &entry) const;
+
+  /**
+   * @brief Non-owning Image over an entry's texels, ready for LoadTextureFromImage.
+   *
+   * The Image borrows the mapping: never pass it to UnloadImage.
+   */
+  Image image(const AssetPackEntry &entry) const;
+
+private:
+  MappedFile data;
+  std::vector<AssetPackEntry> entries;          ///< Copy of the index (the mapping need not be aligned)
+  std::map<std::string, std::size_t, std::less<>> byPath; ///< Path -> index in entries
+};
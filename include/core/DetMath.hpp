@@ -0,0 +1,134 @@
+#pragma once
+#include <cmath>
+
+/**
+ * @file DetMath.hpp
+ * @brief Transcendental functions for the car kinematics, bit-identical across builds on request.
+ *
+ * The C library's sinf/cosf/atan2f/powf differ between platforms and library versions. The
+ * Portable* versions below use only + - * / on doubles plus exact steps (floor, frexp, ldexp),
+ * which IEEE 754 rounds the same everywhere as long as the compiler neither contracts them into
+ * FMAs nor reorders them (see PARKLOGIC_DETERMINISTIC in CMakeLists.txt). sqrtf is correctly
+ * rounded by IEEE 754 and needs no replacement.
+ *
+ * Sin, Cos, Atan2 and Pow pick the portable versions in deterministic builds and the C library
+ * (faster) otherwise.
+ */
+namespace DetMath {
+constexpr double PI_D = 3.14159265358979323846;
+constexpr double LN2_D = 0.69314718055994530942;
+
+/// Sine and cosine of r in [-pi/4, pi/4] (Taylor series, error below 1e-12).
+inline double SinKernel(double r) {
+  double r2 = r * r;
+  return r * (1.0 + r2 * (-1.0 / 6 + r2 * (1.0 / 120 + r2 * (-1.0 / 5040 + r2 * (1.0 / 362880 +
+                                                                                 r2 * (-1.0 / 39916800))))));
+}
+inline double CosKernel(double r) {
+  double r2 = r * r;
+  return 1.0 + r2 * (-1.0 / 2 + r2 * (1.0 / 24 + r2 * (-1.0 / 720 + r2 * (1.0 / 40320 +
+                                                                          r2 * (-1.0 / 3628800 + r2 / 479001600)))));
+}
+
+/// Sine (radians), reduced to a quarter turn around the nearest multiple of pi/2.
+inline float PortableSin(float x) {
+  double quarter = std::floor((double)x / (PI_D / 2) + 0.5);
+  double r = (double)x - quarter * (PI_D / 2);
+  switch (((int)std::fmod(quarter, 4.0) + 4) % 4) {
+  case 0:
+    return (float)SinKernel(r);
+  case 1:
+    return (float)CosKernel(r);
+  case 2:
+    return (float)-SinKernel(r);
+  default:
+    return (float)-CosKernel(r);
+  }
+}
+
+inline float PortableCos(float x) {
+  double quarter = std::floor((double)x / (PI_D / 2) + 0.5);
+  double r = (double)x - quarter * (PI_D / 2);
+  switch (((int)std::fmod(quarter, 4.0) + 4) % 4) {
+  case 0:
+    return (float)CosKernel(r);
+  case 1:
+    return (float)-SinKernel(r);
+  case 2:
+    return (float)-CosKernel(r);
+  default:
+    return (float)SinKernel(r);
+  }
+}
+
+/// Angle of (x, y) in [-pi, pi]; atan is reduced to |t| <= tan(pi/12) and expanded as a series.
+inline float PortableAtan2(float y, float x) {
+  double ax = std::fabs((double)x);
+  double ay = std::fabs((double)y);
+  if (ax == 0.0 && ay == 0.0)
+    return 0.0f;
+
+  double t = ax > ay ? ay / ax : ax / ay; // [0, 1]
+  double offset = 0.0;
+  constexpr double tan15 = 0.26794919243112270;     // tan(pi/12)
+  constexpr double invSqrt3 = 0.57735026918962576; // tan(pi/6)
+  if (t > tan15) {
+    t = (t - invSqrt3) / (1.0 + t * invSqrt3);
+    offset = PI_D / 6;
+  }
+  double t2 = t * t;
+  double angle = t;
+  double term = t;
+  for (int k = 3; k <= 17; k += 2) {
+    term *= -t2;
+    angle += term / k;
+  }
+  angle += offset;
+
+  if (ay > ax)
+    angle = PI_D / 2 - angle;
+  if (x < 0)
+    angle = PI_D - angle;
+  return (float)(y < 0 ? -angle : angle);
+}
+
+/// base^exponent for base > 0 (the kinematics only raise positive factors), as exp(exponent * ln(base)).
+inline float PortablePow(float base, float exponent) {
+  if (base <= 0.0f)
+    return base == 0.0f && exponent > 0.0f ? 0.0f : 1.0f;
+
+  // ln(base) = k ln 2 + 2 atanh(s), with the mantissa folded into [sqrt(1/2), sqrt(2)]
+  int k = 0;
+  double m = std::frexp((double)base, &k);
+  if (m < 0.70710678118654752) {
+    m *= 2.0;
+    k -= 1;
+  }
+  double s = (m - 1.0) / (m + 1.0);
+  double s2 = s * s;
+  double series = 0.0;
+  for (int n = 17; n >= 1; n -= 2)
+    series = series * s2 + 1.0 / n;
+  double y = (double)exponent * (k * LN2_D + 2.0 * s * series);
+
+  // exp(y) = 2^j exp(r), |r| <= ln(2)/2
+  double j = std::floor(y / LN2_D + 0.5);
+  double r = y - j * LN2_D;
+  double result = 1.0;
+  for (int n = 14; n >= 1; --n)
+    result = 1.0 + result * r / n;
+  return (float)std::ldexp(result, (int)j);
+}
+
+#ifdef PARKLOGIC_DETERMINISTIC
+inline float Sin(float x) { return PortableSin(x); }
+inline float Cos(float x) { return PortableCos(x); }
+inline float Atan2(float y, float x) { return PortableAtan2(y, x); }
+inline float Pow(float base, float exponent) { return PortablePow(base, exponent); }
+#else
+inline float Sin(float x) { return std::sin(x); }
+inline float Cos(float x) { return std::cos(x); }
+inline float Atan2(float y, float x) { return std::atan2(y, x); }
+inline float Pow(float base, float exponent) { return std::pow(base, exponent); }
+#endif
+} // namespace DetMath
@@ -0,0 +1,144 @@
+#pragma once
+#include "raylib.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class RenderBackend;
+
+/**
+ * @brief Draw layers, submitted back to front.
+ *
+ * Within BACKGROUND and STATIC commands are reordered by texture so they merge into fewer
+ * batches. The other layers keep recording order, because their contents overlap each other
+ * (cars over cars, text on panels, debug lines on debug lines).
+ */
+enum class DrawLayer : std::uint8_t {
+  BACKGROUND, ///< Ground tiles and baked static chunks.
+  STATIC,     ///< Modules.
+  DECALS,     ///< Flat tints over the map (occupancy heatmap).
+  VEHICLES,   ///< Cars (sprites or far-LOD points).
+  DEBUG,      ///< Paths and waypoint markers.
+  OVERLAY,    ///< World grid and boundary.
+  MASK,       ///< Dark area outside the world.
+  UI,         ///< Screen-space HUD.
+};
+
+/**
+ * @brief Primitive recorded by a DrawCommand.
+ */
+enum class DrawShape : std::uint8_t { SPRITE, PREMULTIPLIED_SPRITE, RECT, RECT_LINES, LINE, CIRCLE, TEXT };
+
+/**
+ * @struct DrawCommand
+ * @brief One recorded primitive.
+ *
+ * Field use per shape:
+ * - SPRITE / PREMULTIPLIED_SPRITE: texture, source, rect (dest), origin, rotation, color (tint).
+ * - RECT / RECT_LINES: rect, size (line thickness), color.
+ * - LINE: rect.x/y (start), end, size (thickness; 0 = one-pixel hairline), color.
+ * - CIRCLE: rect.x/y (center), size (radius), color.
+ * - TEXT: rect.x/y (position), size (font size), color, text range.
+ */
+struct DrawCommand {
+  DrawLayer layer;
+  DrawShape shape;
+  unsigned int key;       ///< Batch key: texture id, DrawList::SHAPES_KEY or DrawList::TEXT_KEY.
+  Texture2D texture = {}; ///< Sprite texture.
+  Rectangle source = {};
+  Rectangle rect = {};
+  Vector2 origin = {};
+  Vector2 end = {};
+  float rotation = 0.0f;
+  float size = 0.0f;
+  Color color = WHITE;
+  std::uint32_t textOffset = 0; ///< Offset in the list's text pool.
+};
+
+/**
+ * @struct DrawBatch
+ * @brief Run of consecutive commands sharing layer and batch key (one GPU draw call).
+ */
+struct DrawBatch {
+  DrawLayer layer;
+  unsigned int key;
+  std::size_t first; ///< Index of the first command.
+  std::size_t count; ///< Number of commands.
+};
+
+/**
+ * @class DrawList
+ * @brief Records draw commands so they can be culled, sorted, batched and then submitted.
+ *
+ * Rendering code records into a list instead of calling raylib directly. submit() sorts the
+ * commands by layer (and by texture inside the reorderable layers), merges neighbours into
+ * DrawBatches and hands them to a RenderBackend: raylib on screen, or a counting backend in
+ * tests, so draw-call counts and culling can be checked without a GL context.
+ */
+class DrawList {
+public:
+  static constexpr unsigned int SHAPES_KEY = 0xFFFFFFFEu; ///< Untextured shapes (never a texture id).
+  static constexpr unsigned int TEXT_KEY = 0xFFFFFFFFu;   ///< Text drawn with the default font.
+
+  /**
+   * @brief Drops subsequently recorded commands that fall entirely outside an area.
+   * @param area Culling rectangle in the list's coordinate space.
+   */
+  void setCullArea(Rectangle area);
+
+  /**
+   * @brief Disables culling.
+   */
+  void clearCullArea() { culling = false; }
+
+  // --- Recording ---
+  void sprite(DrawLayer layer, const Texture2D &texture, Rectangle source, Rectangle dest, Vector2 origin,
+              float rotation, Color tint);
+  /// Sprite whose texture holds premultiplied alpha (e.g. a cached UI panel, see UICache).
+  void premultipliedSprite(DrawLayer layer, const Texture2D &texture, Rectangle source, Rectangle dest);
+  void rect(DrawLayer layer, Rectangle rec, Color color);
+  void rectLines(DrawLayer layer, Rectangle rec, float thickness, Color color);
+  void line(DrawLayer layer, Vector2 start, Vector2 end, float thickness, Color color);
+  void circle(DrawLayer layer, Vector2 center, float radius, Color color);
+  void text(DrawLayer layer, std::string_view str, Vector2 position, int fontSize, Color color);
+
+  /**
+   * @brief Sorts, batches and sends the recorded commands, then clears the list.
+   * @param backend Receiver of the batches.
+   */
+  void submit(RenderBackend &backend);
+
+  /**
+   * @brief Submits to the raylib backend (must be inside the matching camera/texture mode).
+   */
+  void submit();
+
+  /**
+   * @brief Removes all commands and resets the culled counter (culling area is kept).
+   */
+  void clear();
+
+  const std::vector<DrawCommand> &getCommands() const { return commands; }
+  const char *getText(const DrawCommand &cmd) const { return textPool.data() + cmd.textOffset; }
+  std::size_t getCulledCount() const { return culledCount; }
+
+  /**
+   * @brief Whether commands of a layer may be reordered by texture.
+   */
+  static bool isSortable(DrawLayer layer) {
+    return layer == DrawLayer::BACKGROUND || layer == DrawLayer::STATIC;
+  }
+
+private:
+  void push(const DrawCommand &cmd, Rectangle bounds);
+
+  std::vector<DrawCommand> commands;
+  std::vector<DrawBatch> batches;
+  std::string textPool; ///< Null-terminated strings referenced by TEXT commands.
+
+  Rectangle cullArea = {0, 0, 0, 0};
+  bool culling = false;
+  std::size_t culledCount = 0;
+};
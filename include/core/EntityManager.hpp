@@ -1,8 +1,16 @@
 #pragma once
+#include "config.hpp"
 #include "core/EventBus.hpp"
+#include "core/LaneQueues.hpp"
+#include "core/SpatialGrid.hpp"
+#include "core/StaticLayerCache.hpp"
+#include "core/SystemScheduler.hpp"
 #include "entities/Car.hpp"
 #include "entities/map/Modules.hpp"
 #include "entities/map/World.hpp"
+#include "entities/map/WorldGenerator.hpp"
+#include "events/GameEvents.hpp"
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -11,7 +19,11 @@
  * @brief Manages the lifecycle and storage of all game entities.
  *
  * Stores the World, Modules, and Cars.
- * Subscribes to events to trigger spawning, generation, and updates.
+ * Subscribes to events to trigger spawning and generation; car updates run as the scheduled
+ * "physics" system (schedule()).
+ * Background, modules and parked cars are drawn from a baked StaticLayerCache.
+ * Modules and cars are bucketed in SpatialGrids so drawing only visits what is on screen.
+ * Cars on the main road are kept in LaneQueues, which give each of them its leader.
  */
 class EntityManager {
 public:
@@ -29,12 +41,28 @@ public:
   void update(double dt);
 
   /**
-   * @brief Draws all managed entities in the correct order (World -> Modules -> Cars -> Overlay).
+   * @brief Registers update() as the "physics" system at Config::Schedule::PHYSICS_HZ.
    */
-  void draw();
+  void schedule(SystemScheduler &scheduler);
+
+  /**
+   * @brief Draws the entities overlapping the view in the correct order (World -> Modules -> Cars -> Overlay).
+   * @param view Visible World Space area (Meters).
+   * @param lod Detail tier: far out, cars become points and facilities are tinted by occupancy.
+   * @param out Draw list to record into (submitted by the caller inside the world camera).
+   * @param alpha Interpolation of moving cars between the previous (0) and the current (1) tick.
+   */
+  void draw(Rectangle view, RenderLod lod, DrawList &out, float alpha = 1.0f);
+
+  /**
+   * @brief Installs a built world and its modules in one step (between ticks), then publishes the bounds.
+   * @param map World and modules, typically built on a worker thread.
+   */
+  void setMap(GeneratedMap map);
 
   // Entity Management
   void setWorld(std::unique_ptr<World> world);
+  /// Adds a module; adding a road rebuilds the lanes (a whole map is installed with setMap()).
   void addModule(std::unique_ptr<Module> module);
   void addCar(std::unique_ptr<Car> car);
 
@@ -42,12 +70,41 @@ public:
   World *getWorld() const { return world.get(); }
   const std::vector<std::unique_ptr<Module>> &getModules() const { return modules; }
   const std::vector<std::unique_ptr<Car>> &getCars() const { return cars; }
+  const LaneQueues &getLanes() const { return lanes; }
+
+  /**
+   * @brief Counter bumped whenever facility or spot statistics may have changed.
+   *
+   * UI caches compare it against the value they were rendered with.
+   */
+  std::uint64_t getStatsVersion() const { return statsVersion; }
+
+  /**
+   * @brief Hash of every car's state, in car order (see StateHash).
+   *
+   * Equal hashes after the same ticks mean bit-identical runs, e.g. to check that a recorded
+   * run reproduces before comparing performance.
+   */
+  std::uint64_t stateHash() const;
 
   /**
    * @brief Clears all entities and resets the world.
    */
   void clear();
 
+  /**
+   * @brief Re-sorts car storage along a Z-order (Morton) curve of the car positions.
+   *
+   * Cars are moved to fresh allocations in curve order, so cars close on the map sit close in
+   * memory and in the update order. Car pointers change: LaneQueues and the car grid are
+   * updated here, everyone else through CarsRelocatedEvent. Runs every
+   * Config::Render::CAR_REORDER_TICKS ticks from update().
+   */
+  void reorderCars();
+
+  /// Ticks between automatic reorders (0 disables them).
+  void setCarReorderInterval(int ticks) { carReorderInterval = ticks; }
+
   /**
    * @brief Removes a specific car from the simulation.
    * @param car Pointer to the car to remove.
@@ -55,12 +112,56 @@ public:
   void removeCar(Car *car);
 
 private:
+  /**
+   * @brief Stores and buckets a module without touching the lanes.
+   */
+  void insertModule(std::unique_ptr<Module> module);
+
+  /**
+   * @brief Records the static content (tiles, modules, parked cars) overlapping an area.
+   */
+  void drawStatic(Rectangle area, DrawList &out);
+
+  /**
+   * @brief Marks the baked static layer around a point (a spot or parked car) as stale.
+   */
+  void invalidateStaticAround(Vector2 position);
+
+  /**
+   * @brief Far LOD: tints each visible facility from green (empty) to red (full).
+   */
+  void drawFacilityOccupancy(Rectangle view, DrawList &out);
+
+  /**
+   * @brief Far LOD: records every visible moving car as a coloured square (all merge into one batch).
+   */
+  void drawCarPoints(Rectangle view, float alpha, DrawList &out);
+
+  static Rectangle moduleBounds(const Module &mod) {
+    return {mod.worldPosition.x, mod.worldPosition.y, mod.getWidth(), mod.getHeight()};
+  }
+  static Rectangle carBounds(const Car &car);
+
+  /**
+   * @brief Re-buckets every car in the car grid at its current position.
+   */
+  void rebucketCars();
+
   std::shared_ptr<EventBus> eventBus;
   std::vector<Subscription> eventTokens;
 
+  StaticLayerCache staticLayer;
+  SpatialGrid<Module *> moduleGrid;
+  SpatialGrid<Car *> carGrid; ///< Re-bucketed every tick; also the avoidance broadphase
+  LaneQueues lanes;           ///< Re-laid out when a road is added, re-sorted every tick
+  Rectangle lastView = {0, 0, 0, 0}; ///< View of the last drawn frame, baked around on PreRenderEvent
+
   std::unique_ptr<World> world;
   std::vector<std::unique_ptr<Module>> modules;
   std::vector<std::unique_ptr<Car>> cars;
   
   bool dashboardVisible = false;
+  std::uint64_t statsVersion = 0;
+  int carReorderInterval = Config::Render::CAR_REORDER_TICKS;
+  int ticksSinceReorder = 0;
 };
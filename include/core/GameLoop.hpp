@@ -13,9 +13,15 @@ public:
    * @brief Runs the game loop.
    *
    * @param update Function to call for updating game logic (receives delta time).
-   * @param render Function to call for rendering the frame.
+   * @param render Function to call for rendering the frame. Receives the interpolation alpha:
+   *               the fraction of a tick elapsed since the last update, in [0, 1).
    * @param running Function that returns true if the loop should continue.
    */
+  void run(std::function<void(double)> update, std::function<void(double)> render, std::function<bool()> running);
+
+  /**
+   * @brief Runs the game loop with a renderer that does not interpolate.
+   */
   void run(std::function<void(double)> update, std::function<void()> render, std::function<bool()> running);
 
   /**
@@ -0,0 +1,75 @@
+#pragma once
+#include "entities/Car.hpp"
+#include "entities/map/Modules.hpp"
+#include "events/GameEvents.hpp"
+#include <memory>
+#include <span>
+#include <vector>
+
+/**
+ * @class LaneQueues
+ * @brief Cars on the main road, kept ordered along each lane.
+ *
+ * Every road row contributes two lanes (UP drives towards -X, DOWN towards +X). A driving car
+ * belongs to a lane while it is on the lane's line, within the road span and heading along it.
+ * Queues persist between ticks and stay almost sorted, so re-sorting is an insertion sort over
+ * the few cars that overtook or joined. Each car is told its leader (the next car ahead in its
+ * queue), so car-following needs no neighbour search, and whether anyone is close to it in the
+ * lane (which decides its simulation level of detail).
+ */
+class LaneQueues {
+public:
+  /**
+   * @brief Lays out the lanes of every road row.
+   * @param modules The world's modules (roads must not move afterwards).
+   */
+  void build(const std::vector<std::unique_ptr<Module>> &modules);
+
+  /**
+   * @brief Removes lanes and cars (the cars are told they left their lane).
+   */
+  void clear();
+
+  /**
+   * @brief Moves cars between lanes, re-sorts the queues and assigns leaders.
+   * @param cars All cars; cars not on a lane are told so (Car::setLane(-1, ...)).
+   */
+  void update(const std::vector<std::unique_ptr<Car>> &cars);
+
+  /**
+   * @brief Drops a car that is about to be destroyed (its follower gets the next leader).
+   */
+  void remove(Car *car);
+
+  /**
+   * @brief Swaps queued cars for their new addresses and re-assigns leaders.
+   */
+  void relocate(const CarsRelocatedEvent &event);
+
+  std::size_t getLaneCount() const { return lanes.size(); }
+
+  /// Cars of a lane, ordered by increasing X.
+  std::span<Car *const> getCars(int lane) const { return lanes[lane].cars; }
+
+  /**
+   * @brief Lane a car would belong to at its current position and heading.
+   * @return Lane index, or -1 when off the main road.
+   */
+  int laneFor(const Car &car) const;
+
+private:
+  struct LaneQueue {
+    float y;         ///< Lane line (Meters)
+    float direction; ///< +1 drives towards +X, -1 towards -X
+    float minX;      ///< Road span (Meters)
+    float maxX;
+    std::vector<Car *> cars; ///< Ordered by increasing X
+  };
+
+  /**
+   * @brief Tells every car of a lane which car it follows and whether it is isolated.
+   */
+  void assignLeaders(int lane);
+
+  std::vector<LaneQueue> lanes;
+};
@@ -0,0 +1,53 @@
+#pragma once
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * @class MappedFile
+ * @brief Read-only view of a whole file, memory-mapped where the platform allows it.
+ *
+ * Mapping lets the OS page data in on demand and share it with the page cache, so large
+ * files are not copied through a read buffer. If mapping fails the file is read into memory
+ * instead, and the same data()/size() view is exposed.
+ */
+class MappedFile {
+public:
+  MappedFile() = default;
+  ~MappedFile();
+
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+
+  /**
+   * @brief Maps (or reads) a file, replacing any file already open.
+   * @param path File to open.
+   * @return True if the file's contents are available.
+   */
+  bool open(const std::string &path);
+
+  /**
+   * @brief Releases the mapping or the fallback buffer.
+   */
+  void close();
+
+  const unsigned char *data() const { return view; }
+  std::size_t size() const { return length; }
+  bool isOpen() const { return view != nullptr; }
+
+  /**
+   * @brief Whether the view is a real mapping (false when the read fallback was used).
+   */
+  bool isMapped() const { return mapped; }
+
+private:
+  const unsigned char *view = nullptr;
+  std::size_t length = 0;
+  bool mapped = false;
+  std::vector<unsigned char> fallback; ///< File contents when mapping is unavailable
+
+#ifdef _WIN32
+  void *fileHandle = nullptr;
+  void *mappingHandle = nullptr;
+#endif
+};
@@ -0,0 +1,64 @@
+#pragma once
+#include "raylib.h"
+#include <algorithm>
+#include <cmath>
+
+/**
+ * @struct OrientedBox
+ * @brief Rectangle rotated in World Space, e.g. a car footprint.
+ */
+struct OrientedBox {
+  Vector2 center;   ///< Meters
+  Vector2 forward;  ///< Unit vector along the length
+  float halfLength; ///< Along forward
+  float halfWidth;  ///< Across forward
+
+  /**
+   * @brief Axis-aligned bounds, for broadphase queries.
+   */
+  Rectangle bounds() const {
+    float extentX = std::fabs(forward.x) * halfLength + std::fabs(forward.y) * halfWidth;
+    float extentY = std::fabs(forward.y) * halfLength + std::fabs(forward.x) * halfWidth;
+    return {center.x - extentX, center.y - extentY, 2 * extentX, 2 * extentY};
+  }
+};
+
+/**
+ * @brief Separating axis test between two oriented boxes.
+ *
+ * The four candidate axes (both boxes' forward and side directions) are evaluated together over
+ * fixed-size arrays without branches, which compilers turn into vector code.
+ *
+ * @param push If the boxes overlap, receives the smallest translation moving a out of b.
+ * @return True if the boxes overlap.
+ */
+inline bool Overlaps(const OrientedBox &a, const OrientedBox &b, Vector2 *push = nullptr) {
+  const float axisX[4] = {a.forward.x, -a.forward.y, b.forward.x, -b.forward.y};
+  const float axisY[4] = {a.forward.y, a.forward.x, b.forward.y, b.forward.x};
+  const float dx = b.center.x - a.center.x;
+  const float dy = b.center.y - a.center.y;
+
+  float depth[4];
+  for (int i = 0; i < 4; ++i) {
+    // Projected half extents of both boxes and of the center offset on the axis
+    float aFwd = std::fabs(axisX[i] * a.forward.x + axisY[i] * a.forward.y);
+    float aSide = std::fabs(-axisX[i] * a.forward.y + axisY[i] * a.forward.x);
+    float bFwd = std::fabs(axisX[i] * b.forward.x + axisY[i] * b.forward.y);
+    float bSide = std::fabs(-axisX[i] * b.forward.y + axisY[i] * b.forward.x);
+    float radius = aFwd * a.halfLength + aSide * a.halfWidth + bFwd * b.halfLength + bSide * b.halfWidth;
+    depth[i] = radius - std::fabs(axisX[i] * dx + axisY[i] * dy);
+  }
+
+  int best = 0;
+  for (int i = 1; i < 4; ++i)
+    best = depth[i] < depth[best] ? i : best;
+  if (depth[best] <= 0.0f)
+    return false;
+
+  if (push) {
+    // Away from b along the shallowest axis
+    float side = (axisX[best] * dx + axisY[best] * dy) > 0.0f ? -1.0f : 1.0f;
+    *push = {axisX[best] * depth[best] * side, axisY[best] * depth[best] * side};
+  }
+  return true;
+}
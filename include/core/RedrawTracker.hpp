@@ -0,0 +1,50 @@
+#pragma once
+#include "core/EventBus.hpp"
+#include "raylib.h"
+#include <memory>
+#include <vector>
+
+/**
+ * @class RedrawTracker
+ * @brief Decides whether the next frame needs rendering at all.
+ *
+ * Anything that can change what is on screen marks the tracker dirty: input, camera moves,
+ * simulation steps (GameUpdateEvent is only published while the game runs), scene loads
+ * and window resizes. Once nothing has changed for a few frames, the Application stops
+ * redrawing and sleeps between input polls, so a paused lot or a static menu costs almost
+ * no CPU or GPU time.
+ *
+ * A change keeps rendering for Config::Render::REDRAW_SETTLE_FRAMES frames so that every
+ * swap-chain buffer and every PreRenderEvent cache catches up with it.
+ */
+class RedrawTracker {
+public:
+  /**
+   * @brief Constructs the tracker and subscribes to the events that invalidate the frame.
+   * @param bus EventBus to listen on.
+   */
+  explicit RedrawTracker(std::shared_ptr<EventBus> bus);
+
+  /**
+   * @brief Requests that the next frames be rendered.
+   */
+  void requestRedraw();
+
+  /**
+   * @brief Consumes one pending frame.
+   * @return True if this frame must be rendered.
+   */
+  bool shouldRender();
+
+  /**
+   * @brief Whether a redraw is pending (without consuming it).
+   */
+  bool isDirty() const { return pendingFrames > 0; }
+
+private:
+  std::shared_ptr<EventBus> eventBus;
+  std::vector<Subscription> eventTokens;
+
+  int pendingFrames;                     ///< Frames left to render before going idle.
+  Vector2 lastMousePos = {-1.0f, -1.0f}; ///< Mouse moves are published every frame; only real moves count.
+};
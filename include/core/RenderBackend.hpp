@@ -0,0 +1,54 @@
+#pragma once
+#include "core/DrawList.hpp"
+#include <array>
+#include <cstddef>
+
+/**
+ * @class RenderBackend
+ * @brief Receives the batches produced by DrawList::submit().
+ */
+class RenderBackend {
+public:
+  virtual ~RenderBackend() = default;
+
+  /**
+   * @brief Executes one batch.
+   * @param list List owning the commands (for text lookup).
+   * @param batch The batch; its commands are list.getCommands()[first, first + count).
+   */
+  virtual void drawBatch(const DrawList &list, const DrawBatch &batch) = 0;
+};
+
+/**
+ * @class RaylibRenderBackend
+ * @brief Executes commands with raylib's immediate-mode calls.
+ *
+ * Consecutive commands on the same texture land in the same rlgl batch, which is what the
+ * DrawList sort is arranged to produce.
+ */
+class RaylibRenderBackend : public RenderBackend {
+public:
+  void drawBatch(const DrawList &list, const DrawBatch &batch) override;
+};
+
+/**
+ * @class CountingRenderBackend
+ * @brief Headless backend that only counts what it receives (tests, profiling on GPU-less machines).
+ */
+class CountingRenderBackend : public RenderBackend {
+public:
+  static constexpr std::size_t LAYER_COUNT = static_cast<std::size_t>(DrawLayer::UI) + 1;
+
+  void drawBatch(const DrawList &list, const DrawBatch &batch) override;
+
+  /**
+   * @brief Resets all counters.
+   */
+  void reset();
+
+  std::size_t batches = 0;                        ///< Draw calls issued.
+  std::size_t commands = 0;                       ///< Primitives drawn.
+  std::array<std::size_t, LAYER_COUNT> layerBatches = {};
+  std::array<std::size_t, LAYER_COUNT> layerCommands = {};
+  std::vector<DrawBatch> log;                     ///< Every batch, in submission order.
+};
@@ -0,0 +1,116 @@
+#pragma once
+#include "raylib.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+/**
+ * @class SpatialGrid
+ * @brief Uniform bucket grid for area queries in World Space.
+ *
+ * Each item is stored once, in the cell containing the center of its bounds. Queries widen
+ * the searched cell range by the largest half-extent inserted so far and then test bounds
+ * exactly, so results contain no duplicates and no false positives.
+ * Positions outside the grid area are clamped into the border cells.
+ *
+ * @tparam T Item type (typically a pointer or index).
+ */
+template <typename T> class SpatialGrid {
+public:
+  /**
+   * @brief Lays out the grid and removes all items.
+   * @param bounds Area covered by the grid (Meters).
+   * @param cellSize Side length of a cell (Meters).
+   */
+  void reset(Rectangle bounds, float cellSize) {
+    area = bounds;
+    size = cellSize;
+    cols = std::max(1, (int)std::ceil(bounds.width / cellSize));
+    rows = std::max(1, (int)std::ceil(bounds.height / cellSize));
+    cells.assign((size_t)cols * rows, {});
+    maxHalfW = maxHalfH = 0.0f;
+    count = 0;
+  }
+
+  /**
+   * @brief Removes all items but keeps the layout (and cell capacity).
+   */
+  void clear() {
+    for (auto &cell : cells)
+      cell.clear();
+    maxHalfW = maxHalfH = 0.0f;
+    count = 0;
+  }
+
+  /**
+   * @brief Inserts an item.
+   * @param item The item.
+   * @param bounds Item bounds (Meters).
+   */
+  void insert(const T &item, Rectangle bounds) {
+    if (cells.empty())
+      return;
+    maxHalfW = std::max(maxHalfW, bounds.width * 0.5f);
+    maxHalfH = std::max(maxHalfH, bounds.height * 0.5f);
+    cells[cellIndex(bounds.x + bounds.width * 0.5f, bounds.y + bounds.height * 0.5f)].push_back({item, bounds});
+    count++;
+  }
+
+  /**
+   * @brief Removes an item previously inserted with the given bounds.
+   * @return True if the item was found.
+   */
+  bool remove(const T &item, Rectangle bounds) {
+    if (cells.empty())
+      return false;
+    auto &cell = cells[cellIndex(bounds.x + bounds.width * 0.5f, bounds.y + bounds.height * 0.5f)];
+    auto it = std::find_if(cell.begin(), cell.end(), [&](const Entry &e) { return e.item == item; });
+    if (it == cell.end())
+      return false;
+    cell.erase(it);
+    count--;
+    return true;
+  }
+
+  /**
+   * @brief Calls fn(item) for every item whose bounds overlap the area.
+   */
+  template <typename Fn> void query(Rectangle region, Fn &&fn) const {
+    if (count == 0)
+      return;
+    int minX = cellX(region.x - maxHalfW);
+    int maxX = cellX(region.x + region.width + maxHalfW);
+    int minY = cellY(region.y - maxHalfH);
+    int maxY = cellY(region.y + region.height + maxHalfH);
+
+    for (int cy = minY; cy <= maxY; ++cy) {
+      for (int cx = minX; cx <= maxX; ++cx) {
+        for (const Entry &e : cells[(size_t)cy * cols + cx]) {
+          if (CheckCollisionRecs(e.bounds, region))
+            fn(e.item);
+        }
+      }
+    }
+  }
+
+  size_t getCount() const { return count; }
+
+private:
+  struct Entry {
+    T item;
+    Rectangle bounds;
+  };
+
+  int cellX(float x) const { return std::clamp((int)std::floor((x - area.x) / size), 0, cols - 1); }
+  int cellY(float y) const { return std::clamp((int)std::floor((y - area.y) / size), 0, rows - 1); }
+  size_t cellIndex(float x, float y) const { return (size_t)cellY(y) * cols + cellX(x); }
+
+  std::vector<std::vector<Entry>> cells;
+  Rectangle area = {0, 0, 0, 0};
+  float size = 1.0f;
+  int cols = 0;
+  int rows = 0;
+  float maxHalfW = 0.0f;
+  float maxHalfH = 0.0f;
+  size_t count = 0;
+};
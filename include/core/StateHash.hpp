@@ -0,0 +1,32 @@
+#pragma once
+#include "raylib.h"
+#include <bit>
+#include <cstdint>
+
+/**
+ * @class StateHash
+ * @brief FNV-1a hash over the exact bits of simulation state.
+ *
+ * Floats are hashed by their bit pattern, so two runs hash alike only if they are bit-identical
+ * (a deterministic build, PARKLOGIC_DETERMINISTIC, makes that hold across compilers and flags).
+ */
+class StateHash {
+public:
+  void add(std::uint64_t value) {
+    for (int i = 0; i < 8; ++i) {
+      hash ^= (value >> (8 * i)) & 0xFF;
+      hash *= PRIME;
+    }
+  }
+  void add(float value) { add((std::uint64_t)std::bit_cast<std::uint32_t>(value)); }
+  void add(Vector2 value) {
+    add(value.x);
+    add(value.y);
+  }
+
+  std::uint64_t value() const { return hash; }
+
+private:
+  static constexpr std::uint64_t PRIME = 0x100000001b3ULL;
+  std::uint64_t hash = 0xcbf29ce484222325ULL;
+};
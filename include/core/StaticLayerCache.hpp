@@ -0,0 +1,97 @@
+#pragma once
+#include "core/DrawList.hpp"
+#include "raylib.h"
+#include <functional>
+#include <vector>
+
+/**
+ * @class StaticLayerCache
+ * @brief Caches the non-moving part of the map in chunked render textures.
+ *
+ * The world is split into square chunks of Config::Render::STATIC_CHUNK_SIZE texels, baked at
+ * art-pixel resolution. A chunk is only re-rendered after it has been invalidated (world
+ * regenerated, spot state changed, car parked), so drawing the background, the modules and
+ * the parked cars costs one textured quad per visible chunk.
+ *
+ * Chunks are baked lazily around the view. Once more than Config::Render::MAX_RESIDENT_CHUNKS
+ * hold a texture, the least recently drawn off-screen ones are released, so VRAM use is
+ * bounded by the view size rather than the world size.
+ *
+ * Baking switches render targets, so rebake() must run outside any BeginTextureMode() block
+ * (see PreRenderEvent).
+ */
+class StaticLayerCache {
+public:
+  /// Records all static content overlapping the given World Space area (Meters).
+  using DrawAreaFn = std::function<void(Rectangle area, DrawList &out)>;
+
+  StaticLayerCache() = default;
+  ~StaticLayerCache();
+
+  StaticLayerCache(const StaticLayerCache &) = delete;
+  StaticLayerCache &operator=(const StaticLayerCache &) = delete;
+
+  /**
+   * @brief Lays out the chunk grid for a world and marks every chunk dirty.
+   * @param width World width in Meters.
+   * @param height World height in Meters.
+   */
+  void reset(float width, float height);
+
+  /**
+   * @brief Releases all chunk textures.
+   */
+  void clear();
+
+  /**
+   * @brief Marks every chunk for re-baking.
+   */
+  void invalidateAll();
+
+  /**
+   * @brief Marks the chunks overlapping an area for re-baking.
+   * @param area World Space rectangle (Meters).
+   */
+  void invalidateArea(Rectangle area);
+
+  /**
+   * @brief Re-renders the dirty chunks around the view and evicts surplus off-screen chunks.
+   * @param view World Space area about to be drawn (Meters).
+   * @param drawArea Callback drawing the static content of one chunk.
+   */
+  void rebake(Rectangle view, const DrawAreaFn &drawArea);
+
+  /**
+   * @brief Records the chunks overlapping the view.
+   * @param view Visible World Space area (Meters).
+   * @param drawFallback Called with the visible part of chunks not baked yet, to record their content directly.
+   * @param out Draw list to record into.
+   */
+  void draw(Rectangle view, const DrawAreaFn &drawFallback, DrawList &out);
+
+  /**
+   * @brief Number of chunks currently holding a texture.
+   */
+  int getResidentCount() const { return residentCount; }
+
+private:
+  struct Chunk {
+    Rectangle bounds;              ///< Area covered in World Space (Meters).
+    RenderTexture2D target = {};   ///< Baked content (id 0 until baked or after eviction).
+    bool dirty = true;
+    unsigned int lastDrawn = 0;    ///< Frame counter value when last drawn (for eviction).
+  };
+
+  /// Inclusive chunk index range overlapping an area; false if the area misses the grid.
+  bool chunkRange(Rectangle area, int &minX, int &maxX, int &minY, int &maxY) const;
+
+  /// Releases least recently drawn chunks outside the view until the budget is met.
+  void evict(Rectangle view);
+
+  std::vector<Chunk> chunks;
+  DrawList bakeList; ///< Reused for every chunk bake
+  int columns = 0;
+  int rows = 0;
+  int residentCount = 0;
+  unsigned int frame = 0;
+};
@@ -0,0 +1,133 @@
+#pragma once
+#include "config.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+class ThreadPool;
+
+/// Shared simulation state that systems declare access to (bit flags, see SystemScheduler::Access).
+namespace SimState {
+constexpr std::uint32_t CAR_KINEMATICS = 1u << 0; ///< Car positions, velocities, paths and states
+constexpr std::uint32_t CAR_LIST = 1u << 1;       ///< Which cars exist and where they are stored
+constexpr std::uint32_t SPOT_STATE = 1u << 2;     ///< Free/reserved/occupied spots
+constexpr std::uint32_t ROAD_FLOW = 1u << 3;      ///< Mesoscopic through-traffic (RoadFlow)
+constexpr std::uint32_t STATIC_LAYER = 1u << 4;   ///< Baked map chunks, invalidated when cars park or leave
+constexpr std::uint32_t TRACKING = 1u << 5;       ///< The car the camera follows
+constexpr std::uint32_t CAMERA = 1u << 6;         ///< Camera target and zoom
+constexpr std::uint32_t ALL = ~0u;
+
+/// Name of a single flag (for logs and the graph dump).
+const char *Name(std::uint32_t flag);
+} // namespace SimState
+
+/**
+ * @class SystemScheduler
+ * @brief Runs simulation systems each at its own rate, in dependency order, in parallel where possible.
+ *
+ * A system declares a rate in Hz, which is rounded to a whole number of ticks (its period; at
+ * least one). When it runs it is given the time accumulated since it last ran, so slow systems
+ * integrate exactly as much time as fast ones. Systems sharing a period slower than the tick
+ * are spread over different ticks (phase), so they do not all land on the same tick.
+ *
+ * Each system also declares the SimState it reads and writes. Two systems conflict when one
+ * writes what the other reads or writes; a conflicting system runs after the ones added before
+ * it. This gives a DAG, cut into stages (longest path from a root): the systems of a stage are
+ * independent, and with a ThreadPool the ones due on a tick run concurrently. Stages always run
+ * in order, so a tick gives the same result with or without workers.
+ */
+class SystemScheduler {
+public:
+  using Task = std::function<void(double dt)>;
+
+  /// SimState flags a system reads and writes.
+  struct Access {
+    std::uint32_t reads = 0;
+    std::uint32_t writes = 0;
+  };
+
+  struct System {
+    std::string name;
+    double rateHz;
+    int period;                     ///< Ticks between runs
+    int phase;                      ///< Runs on ticks where tick % period == phase
+    Access access;
+    int stage = 0;                  ///< Position in the DAG (0: depends on nothing)
+    std::vector<std::size_t> after; ///< Indices of the systems this one must follow
+    double pendingDt = 0.0;         ///< Time accumulated since the last run
+    Task task;
+  };
+
+  /**
+   * @param tickDt Time per tick the rates are converted with (Seconds).
+   */
+  explicit SystemScheduler(double tickDt = Config::FIXED_DELTA_TIME);
+
+  /**
+   * @brief Registers a system.
+   * @param name For logging and inspection.
+   * @param rateHz Runs per second (the tick rate or above: every tick).
+   * @param access SimState read and written; decides what it may run alongside.
+   * @param task Called with the time elapsed since its last run.
+   */
+  void add(std::string name, double rateHz, Access access, Task task);
+
+  /**
+   * @brief Registers a system that conflicts with every other (runs on its own stage).
+   */
+  void add(std::string name, double rateHz, Task task) {
+    add(std::move(name), rateHz, Access{SimState::ALL, SimState::ALL}, std::move(task));
+  }
+
+  /**
+   * @brief Workers for systems sharing a stage (nullptr: everything runs on the calling thread).
+   *
+   * The calling thread runs one system of each stage itself, so a single worker is enough.
+   */
+  void setWorkers(ThreadPool *pool) { workers = pool; }
+
+  /**
+   * @brief Advances one tick, running every system due on it.
+   * @param dt Time of this tick.
+   */
+  void tick(double dt);
+
+  /**
+   * @brief Removes all systems and restarts the tick count.
+   */
+  void clear();
+
+  const std::vector<System> &getSystems() const { return systems; }
+  std::uint64_t getTickCount() const { return tickCount; }
+
+  /**
+   * @brief Indices of the systems in each stage, stages in run order.
+   */
+  const std::vector<std::vector<std::size_t>> &getStages() const { return stages; }
+
+  /**
+   * @brief The dependency graph in Graphviz DOT format, systems grouped by stage and edges
+   * labelled with the state they conflict on.
+   */
+  std::string toDot() const;
+
+private:
+  /**
+   * @brief Tick offset for a new system of this period that shares the fewest ticks with the others.
+   */
+  int pickPhase(int period) const;
+
+  /// SimState flags two systems conflict on (0: they may run concurrently).
+  static std::uint32_t Conflicts(const Access &a, const Access &b);
+
+  void runStage(const std::vector<System *> &due);
+
+  double tickDt;
+  std::uint64_t tickCount = 0;
+  std::vector<System> systems;
+  std::vector<std::vector<std::size_t>> stages;
+  ThreadPool *workers = nullptr;
+};
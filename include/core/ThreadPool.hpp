@@ -0,0 +1,63 @@
+#pragma once
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @class ThreadPool
+ * @brief Fixed set of worker threads running queued CPU jobs.
+ *
+ * Jobs must not touch the GL context or raylib state owned by the main thread (textures,
+ * window, input); they return plain data that the main thread then consumes.
+ */
+class ThreadPool {
+public:
+  /**
+   * @brief Starts the workers.
+   * @param threadCount Number of workers (0 = one per hardware thread, at least one).
+   */
+  explicit ThreadPool(std::size_t threadCount = 0);
+
+  /**
+   * @brief Finishes the queued jobs and joins the workers.
+   */
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  /**
+   * @brief Queues a job.
+   * @param job Callable taking no arguments.
+   * @return Future for the job's result (exceptions are rethrown by get()).
+   */
+  template <typename F> auto submit(F &&job) -> std::future<std::invoke_result_t<F>> {
+    using Result = std::invoke_result_t<F>;
+    auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(job));
+    std::future<Result> result = task->get_future();
+    enqueue([task]() { (*task)(); });
+    return result;
+  }
+
+  /**
+   * @brief Number of worker threads.
+   */
+  std::size_t size() const { return workers.size(); }
+
+private:
+  void enqueue(std::function<void()> job);
+  void workerLoop();
+
+  std::vector<std::thread> workers;
+  std::queue<std::function<void()>> jobs;
+  std::mutex mutex;
+  std::condition_variable available;
+  bool stopping = false;
+};
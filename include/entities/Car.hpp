@@ -1,7 +1,11 @@
 #pragma once
+#include "core/AssetManager.hpp"
+#include "core/DrawList.hpp"
+#include "core/OrientedBox.hpp"
+#include "core/SpatialGrid.hpp"
+#include "core/StateHash.hpp"
 #include "entities/Entity.hpp"
 #include "raylib.h"
-#include <deque>
 #include <memory>
 #include <string>
 #include <vector>
@@ -12,10 +16,12 @@ class World;
  * @class Car
  * @brief Represents an autonomous car entity.
  *
- * The Car class implements steering behaviors (seek) to navigate through waypoints.
- * It supports collision avoidance and dynamic waypoint generation.
+ * The Car class follows its path by pure pursuit (steering at a point a speed-dependent distance
+ * ahead along the path's segments). On a main road lane it keeps its distance to the car ahead
+ * with the Intelligent Driver Model; elsewhere (inside facilities) it avoids nearby cars.
  */
 #include "entities/map/Modules.hpp"
+#include "entities/map/Path.hpp"
 #include "entities/map/Waypoint.hpp"
 
 class Car : public Entity {
@@ -42,16 +48,31 @@ public:
    * @brief Updates the car's state with awareness of other cars.
    *
    * @param dt Delta time in seconds.
-   * @param cars Pointer to the list of other cars for collision avoidance.
+   * @param neighbors Broadphase of the other cars for collision avoidance (not queried while in a lane).
    */
-  void updateWithNeighbors(double dt, const std::vector<std::unique_ptr<Car>> *cars = nullptr);
+  void updateWithNeighbors(double dt, const SpatialGrid<Car *> *neighbors = nullptr);
 
   /**
-   * @brief Draws the car and its debug info (waypoints, velocity).
+   * @brief Records the car and its debug info (waypoints, velocity).
+   * @param out Draw list to record into.
    * @param showPath Whether to draw the path lines.
+   * @param pathMarkers Whether to mark each waypoint (skipped at lower detail).
+   * @param alpha Interpolation between the previous (0) and the current (1) tick.
    */
-  void draw(bool showPath);
-  void draw() override { draw(false); }
+  void draw(DrawList &out, bool showPath, bool pathMarkers = true, float alpha = 1.0f) const;
+
+  /**
+   * @brief Draws the car immediately (no path).
+   */
+  void draw() override;
+
+  /**
+   * @brief Records only the path debug lines (used when the car itself is drawn as a point).
+   * @param out Draw list to record into.
+   * @param markers Whether to mark each waypoint.
+   * @param alpha Interpolation between the previous (0) and the current (1) tick.
+   */
+  void drawPath(DrawList &out, bool markers, float alpha = 1.0f) const;
 
   // --- State Management ---
   enum class CarState { DRIVING, ALIGNING, PARKED, EXITING };
@@ -65,10 +86,18 @@ public:
   /**
    * @brief Adds a waypoint to the car's path.
    *
+   * Copies the remaining path into a new one; prefer building the whole path up front.
    * @param wp The target waypoint.
    */
   void addWaypoint(Waypoint wp);
 
+  /**
+   * @brief Follows a shared path from its first waypoint (no waypoints are copied).
+   *
+   * @param path The path to follow (null clears it).
+   */
+  void setPath(PathHandle path);
+
   /**
    * @brief Sets the entire path of waypoints.
    *
@@ -81,13 +110,75 @@ public:
    */
   void clearWaypoints();
 
+  const PathHandle &getPath() const { return path; }
+  std::size_t getRemainingWaypoints() const { return path ? path->size() - pathCursor : 0; }
+
   Vector2 getPosition() const { return position; }
+
+  /**
+   * @brief Position blended between the previous and the current tick, for drawing.
+   * @param alpha 0 = previous tick, 1 = current tick.
+   */
+  Vector2 getRenderPosition(float alpha) const;
+
+  /**
+   * @brief Sprite rotation (degrees) blended between the previous and the current tick.
+   * @param alpha 0 = previous tick, 1 = current tick.
+   */
+  float getRenderRotation(float alpha) const;
+
+  /**
+   * @brief The car's footprint (sprite size) at its current position and rotation.
+   */
+  OrientedBox getFootprint() const;
+
+  /**
+   * @brief Adds the car's kinematic and behavioural state to a hash.
+   */
+  void hashState(StateHash &hash) const;
+
   Vector2 getVelocity() const { return velocity; }
   void setVelocity(Vector2 v) { velocity = v; }
 
   bool isReadyToLeave() const { return state == CarState::PARKED && parkingTimer <= 0.0f; }
+  /// Runs down the parking time (driven by TrafficSystem's parking system, not by update()).
+  void countDownParking(float dt) {
+    if (state == CarState::PARKED)
+      parkingTimer -= dt;
+  }
 
-  bool hasArrived() const { return waypoints.empty(); }
+  bool hasArrived() const { return getRemainingWaypoints() == 0; }
+
+  /**
+   * @brief Main road lane membership, maintained by LaneQueues.
+   * @param lane Lane index, -1 when off the main road.
+   * @param direction +1 or -1: the lane's driving direction along X.
+   * @param leader The next car ahead in the lane, if any.
+   * @param isolated No other car within SimLod::ISOLATION_GAP in the lane.
+   */
+  void setLane(int lane, float direction, const Car *leader, bool isolated = false) {
+    this->lane = lane;
+    laneDirection = direction;
+    this->leader = leader;
+    laneIsolated = isolated;
+  }
+  int getLane() const { return lane; }
+  const Car *getLeader() const { return leader; }
+
+  /**
+   * @brief Simulation level of detail, re-evaluated after every full update.
+   *
+   * FULL: path following, avoidance and rotation every tick. CRUISE: an isolated car on a long
+   * straight stretch of a lane at steady speed; its position is evaluated in closed form
+   * (origin + velocity * time) until its cruise horizon, the next full update.
+   */
+  enum class SimLod { FULL, CRUISE };
+  SimLod getSimLod() const { return simLod; }
+
+  /**
+   * @brief Allows or forbids the CRUISE tier for every car (benchmarks compare both).
+   */
+  static void SetSimLodEnabled(bool enabled) { simLodEnabled = enabled; }
 
   // Context for Parking
   // Used to generate the exit path.
@@ -106,6 +197,10 @@ private:
   float targetRotation = 0.0f;
   float currentRotation = 0.0f; // degrees, for smooth rendering
 
+  // Pose at the start of the last tick, blended with the current one when drawing
+  Vector2 previousPosition;
+  float previousRotation = 0.0f;
+
   const Module *parkedFacility = nullptr;
   Spot parkedSpot = {{0, 0}, 0.0f, -1};
   int parkedSpotIndex = -1;
@@ -113,7 +208,34 @@ private:
   float maxSpeed;
   float maxForce;
 
-  std::deque<Waypoint> waypoints;
+  PathHandle path;            ///< Shared, immutable
+  std::size_t pathCursor = 0; ///< Index of the waypoint being driven to
+  Vector2 pathOrigin = {0, 0}; ///< Where the path was assigned: start of the first segment
+
+  int lane = -1;               ///< Main road lane (LaneQueues), -1 when off the road
+  float laneDirection = 0.0f;  ///< +1 / -1 along X
+  const Car *leader = nullptr; ///< Car ahead in the lane
+  bool laneIsolated = false;   ///< Nobody close in the lane
+
+  SimLod simLod = SimLod::FULL;
+  Vector2 cruiseOrigin = {0, 0}; ///< Position at the start of the cruise
+  float cruiseElapsed = 0.0f;    ///< Seconds since then
+  float cruiseHorizon = 0.0f;    ///< Seconds the cruise may last
+  static inline bool simLodEnabled = true;
+
+  /**
+   * @brief Whether the car may run at the CRUISE tier until its next full update.
+   */
+  bool canCruise() const;
+
+  /**
+   * @brief How long a cruise may last before a full update is needed.
+   *
+   * Until the car is CLEAR_AHEAD from its waypoint, or (at the current closing speed) comes
+   * within ISOLATION_GAP of its leader; capped at MAX_CRUISE_TIME. Cars joining the lane
+   * nearby end the cruise early through the isolation flag.
+   */
+  float cruiseTime() const;
 
   /**
    * @brief Applies a force to the car's acceleration.
@@ -123,17 +245,40 @@ private:
   void applyForce(Vector2 force);
 
   /**
-   * @brief Calculates and applies a steering force towards a target.
+   * @brief Advances past reached waypoints and steers along the path (pure pursuit).
+   */
+  void followPath();
+
+  /**
+   * @brief Point on the path LOOKAHEAD ahead of the car's projection onto the current segment.
    *
-   * @param wp The target waypoint.
+   * The walk may continue into the next segment by at most the current waypoint's tolerance,
+   * so turns are rounded off without leaving the phase's tolerance (and never past a stop).
+   */
+  Vector2 lookaheadPoint(float lookahead) const;
+
+  /**
+   * @brief Speed the car wants on the way to a waypoint (segment limit, turn slowdown, stopping).
    */
+  float targetSpeed(const Waypoint &wp) const;
+
   /**
-   * @brief Calculates and applies a steering force towards a target.
+   * @brief Replaces the longitudinal acceleration by the Intelligent Driver Model's.
    *
-   * @param wp The target waypoint.
+   * Free road: accelerate towards the target speed. Behind a leader: brake to keep a gap of
+   * MIN_GAP plus TIME_HEADWAY of travel, more when closing in.
+   * @param dt Delta time in seconds (the car never reverses).
+   */
+  void followLeader(double dt);
+
+  /**
+   * @brief Calculates and applies a steering force towards an aim point.
+   *
+   * @param wp The waypoint being driven to (speed limit, turn and stop behaviour).
+   * @param aim Where to head right now.
    */
-  void seek(const Waypoint &wp);
-  std::string textureName;
+  void seek(const Waypoint &wp, Vector2 aim);
+  TextureHandle texture = INVALID_TEXTURE; ///< Resolved once from the variant name
 
   // New Members for Traffic Overhaul
 public:
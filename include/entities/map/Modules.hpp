@@ -4,6 +4,8 @@
  * @file Modules.hpp
  * @brief Defines the building blocks of the game map (Roads, Parking, Charging).
  */
+#include "core/AssetManager.hpp"
+#include "core/DrawList.hpp"
 #include "entities/map/Waypoint.hpp"
 #include "raylib.h"
 #include <vector>
@@ -81,9 +83,9 @@ public:
   Vector2 worldPosition = {0, 0}; ///< Top-left position in the World (Meters).
 
   /**
-   * @brief Draws the module using specific logic per type.
+   * @brief Records the module's texture (resolved once at construction) over its footprint.
    */
-  virtual void draw() const;
+  virtual void draw(DrawList &out) const;
 
   // --- Pathfinding & Waypoints ---
   /**
@@ -108,6 +110,7 @@ public:
   int getRandomSpotIndex() const;
   Spot getSpot(int index) const;
   void setSpotState(int index, SpotState state);
+  void setSpotPrice(int index, float price); ///< Restores a saved price (see WorldSnapshot)
 
   struct SpotCounts {
     int free;
@@ -127,6 +130,7 @@ protected:
   float width;
   float height;
   float priceMultiplier = 1.0f;
+  TextureHandle texture = INVALID_TEXTURE; ///< Set by each concrete module's constructor
   std::vector<AttachmentPoint> attachmentPoints;
   std::vector<Waypoint> localWaypoints;
   std::vector<Spot> spots;
@@ -138,25 +142,25 @@ protected:
 class NormalRoad : public Module {
 public:
   NormalRoad();
-  void draw() const override;
+  ModuleType getType() const override { return ModuleType::ROAD; }
 };
 
 class UpEntranceRoad : public Module {
 public:
   UpEntranceRoad();
-  void draw() const override;
+  ModuleType getType() const override { return ModuleType::ROAD; }
 };
 
 class DownEntranceRoad : public Module {
 public:
   DownEntranceRoad();
-  void draw() const override;
+  ModuleType getType() const override { return ModuleType::ROAD; }
 };
 
 class DoubleEntranceRoad : public Module {
 public:
   DoubleEntranceRoad();
-  void draw() const override;
+  ModuleType getType() const override { return ModuleType::ROAD; }
 };
 
 // --- Facilities ---
@@ -164,7 +168,6 @@ public:
 class SmallParking : public Module {
 public:
   SmallParking(bool isTop);
-  void draw() const override;
   bool isUp() const override { return isTop; }
   ModuleType getType() const override { return ModuleType::SMALL_PARKING; }
 
@@ -175,7 +178,6 @@ private:
 class LargeParking : public Module {
 public:
   LargeParking(bool isTop);
-  void draw() const override;
   bool isUp() const override { return isTop; }
   ModuleType getType() const override { return ModuleType::LARGE_PARKING; }
 
@@ -186,7 +188,6 @@ private:
 class SmallChargingStation : public Module {
 public:
   SmallChargingStation(bool isTop);
-  void draw() const override;
   bool isUp() const override { return isTop; }
   ModuleType getType() const override { return ModuleType::SMALL_CHARGING; }
 
@@ -197,7 +198,6 @@ private:
 class LargeChargingStation : public Module {
 public:
   LargeChargingStation(bool isTop);
-  void draw() const override;
   bool isUp() const override { return isTop; }
   ModuleType getType() const override { return ModuleType::LARGE_CHARGING; }
 
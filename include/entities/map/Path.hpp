@@ -0,0 +1,42 @@
+#pragma once
+#include "entities/map/Waypoint.hpp"
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+
+/**
+ * @class Path
+ * @brief Immutable sequence of waypoints, shared between the cars that follow it.
+ *
+ * A path is a short car-specific lead (e.g. the approach from the car's position) followed by
+ * a tail borrowed from shared storage such as the RouteTable's waypoint array, which the path
+ * keeps alive. Cars hold a PathHandle and their own cursor, so handing a path over never copies
+ * waypoints.
+ */
+class Path {
+public:
+  /**
+   * @param lead Waypoints owned by this path.
+   * @param tail Waypoints followed after the lead, borrowed from tailOwner's storage.
+   * @param tailOwner Keeps the tail's storage alive as long as the path is.
+   */
+  explicit Path(std::vector<Waypoint> lead, std::span<const Waypoint> tail = {},
+                std::shared_ptr<const void> tailOwner = nullptr)
+      : lead(std::move(lead)), tail(tail), tailOwner(std::move(tailOwner)) {}
+
+  std::size_t size() const { return lead.size() + tail.size(); }
+  bool empty() const { return size() == 0; }
+
+  const Waypoint &operator[](std::size_t index) const {
+    return index < lead.size() ? lead[index] : tail[index - lead.size()];
+  }
+
+private:
+  std::vector<Waypoint> lead;
+  std::span<const Waypoint> tail;
+  std::shared_ptr<const void> tailOwner;
+};
+
+using PathHandle = std::shared_ptr<const Path>;
@@ -1,5 +1,10 @@
 #pragma once
+#include "core/AssetManager.hpp"
+#include "core/DrawList.hpp"
 #include "entities/Entity.hpp"
+#include "raylib.h"
+#include <cstdint>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -15,27 +20,46 @@ class World : public Entity {
 public:
   World(float width, float height);
 
+  /**
+   * @brief Builds a world with a known background (e.g. from a WorldSnapshot).
+   * @param tiles Row-major tile texture indices, TileColumns(width) * TileRows(height) of them.
+   */
+  World(float width, float height, std::span<const std::uint8_t> tiles);
+
   void update(double dt) override;
   void draw() override;
-  void drawOverlay(); // Draws grid and borders on top of entities
+  void drawBackground(Rectangle area, DrawList &out); // Records the background tiles overlapping area (Meters)
+  void drawOverlay(Rectangle view, DrawList &out); // Records grid and borders, limited to the visible area (Meters)
 
   void setGridEnabled(bool enabled) { showGrid = enabled; }
   bool isGridEnabled() const { return showGrid; }
   void toggleGrid() { showGrid = !showGrid; }
 
-  void drawMask(); // Draws the dark foreground mask outside the world
+  void drawMask(DrawList &out); // Records the dark foreground mask outside the world
 
   float getWidth() const { return width; }
   float getHeight() const { return height; }
 
+  // Background tile grid covering a world of the given size
+  static int TileColumns(float width);
+  static int TileRows(float height);
+  int getTileColumns() const { return backgroundTiles.empty() ? 0 : (int)backgroundTiles[0].size(); }
+  int getTileRows() const { return (int)backgroundTiles.size(); }
+  int getTile(int column, int row) const { return backgroundTiles[row][column]; }
+
 private:
+  /**
+   * @brief Resolves the tile textures and sizes the (zeroed) tile grid.
+   */
+  void initTiles();
+
   float width;
   float height;
   bool showGrid;
 
   // Background
   std::vector<std::vector<int>> backgroundTiles; // Stores index of texture to use
-  std::vector<std::string> tileTextures;         // Texture names
+  std::vector<TextureHandle> tileTextures;       // Resolved texture handles
   float tileWidthMeter;
   float tileHeightMeter;
 };
@@ -2,6 +2,7 @@
 #include "entities/map/Modules.hpp"
 #include "entities/map/World.hpp"
 #include "events/GameEvents.hpp"
+#include <atomic>
 #include <memory>
 #include <vector>
 
@@ -29,7 +30,18 @@ public:
   /**
    * @brief Generates a new map based on the configuration.
    * @param config The user-defined parameters (count of facilities).
+   * @param progress If set, raised from 0 to 1 as generation advances (may be polled from another thread).
    * @return A struct containing the World and Modules.
    */
-  static GeneratedMap generate(const struct MapConfig &config);
+  static GeneratedMap generate(const struct MapConfig &config, std::atomic<float> *progress = nullptr);
+
+  /**
+   * @brief Builds the map a config asks for: its WorldSnapshot if one is set and usable, else a generated one.
+   *
+   * Safe to run on a worker thread once the asset manifest is loaded (texture handles are only looked up),
+   * but only one at a time: modules and the world draw from raylib's global RNG (GetRandomValue).
+   * @param config Facility counts and optional snapshot path.
+   * @param progress See generate().
+   */
+  static GeneratedMap create(const struct MapConfig &config, std::atomic<float> *progress = nullptr);
 };
@@ -0,0 +1,122 @@
+#pragma once
+#include "core/MappedFile.hpp"
+#include "entities/map/Modules.hpp"
+#include "entities/map/World.hpp"
+#include "entities/map/WorldGenerator.hpp"
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+/**
+ * @file WorldSnapshot.hpp
+ * @brief Flat binary save of a generated world, read in place through a memory mapping.
+ *
+ * Layout (little-endian, every section 4-byte aligned):
+ * - a WorldSnapshotHeader,
+ * - moduleCount WorldSnapshotModule records, in EntityManager order,
+ * - priceCount floats: the spot prices of every module, each module owning a contiguous run,
+ * - tileRows * tileColumns bytes: background tile indices, row-major.
+ *
+ * Only what the generator randomises is stored. Spot layouts, waypoints and attachment points
+ * are rebuilt by the module constructors, so loading is one pass over the records.
+ */
+
+/**
+ * @struct WorldSnapshotHeader
+ * @brief First bytes of a snapshot file.
+ */
+struct WorldSnapshotHeader {
+  char magic[4];            ///< "PLWS"
+  std::uint32_t version;    ///< WorldSnapshot::VERSION
+  std::uint32_t moduleCount;
+  std::uint32_t priceCount;
+  float worldWidth;         ///< Meters
+  float worldHeight;        ///< Meters
+  std::uint32_t tileColumns;
+  std::uint32_t tileRows;
+};
+
+/// Concrete module class stored in a snapshot record.
+enum class SnapshotModuleKind : std::uint16_t {
+  NORMAL_ROAD,
+  UP_ENTRANCE_ROAD,
+  DOWN_ENTRANCE_ROAD,
+  DOUBLE_ENTRANCE_ROAD,
+  SMALL_PARKING,
+  LARGE_PARKING,
+  SMALL_CHARGING,
+  LARGE_CHARGING,
+  COUNT
+};
+
+/**
+ * @struct WorldSnapshotModule
+ * @brief One placed module.
+ */
+struct WorldSnapshotModule {
+  std::uint16_t kind;          ///< SnapshotModuleKind
+  std::uint16_t isTop;         ///< Facilities: attached above the road
+  std::int32_t parent;         ///< Index of the parent module, -1 for none
+  float x;                     ///< World position (Meters)
+  float y;
+  float priceMultiplier;
+  std::uint32_t firstPrice;    ///< Index of the module's first spot price
+  std::uint32_t spotCount;
+  std::uint32_t reserved;
+};
+
+static_assert(sizeof(WorldSnapshotHeader) == 32, "snapshot header layout");
+static_assert(sizeof(WorldSnapshotModule) == 32, "snapshot module layout");
+
+/**
+ * @class WorldSnapshot
+ * @brief Reader (and writer) for world snapshot files.
+ *
+ * A loaded world is identical to the saved one: same modules, positions, parents, prices
+ * and background, whatever the random state of the run.
+ */
+class WorldSnapshot {
+public:
+  static constexpr std::uint32_t VERSION = 1;
+
+  /**
+   * @brief Writes a snapshot of a world and its modules.
+   * @param file Output path.
+   * @param world World whose size and background are saved.
+   * @param modules Modules in the order they are managed (parents must be among them).
+   * @return False if a module cannot be stored or the file cannot be written.
+   */
+  static bool Write(const std::string &file, const World &world, const std::vector<std::unique_ptr<Module>> &modules);
+
+  /**
+   * @brief Maps a snapshot and validates it.
+   * @param file Snapshot path.
+   * @return False if the file is missing, truncated, inconsistent or not a snapshot of this version.
+   */
+  bool open(const std::string &file);
+
+  void close();
+  bool isOpen() const { return data.isOpen(); }
+
+  const WorldSnapshotHeader &header() const;
+  std::span<const WorldSnapshotModule> modules() const;
+  std::span<const float> prices() const;
+  std::span<const std::uint8_t> tiles() const;
+
+  /**
+   * @brief Rebuilds the world and modules recorded in the open snapshot.
+   */
+  GeneratedMap instantiate() const;
+
+  /**
+   * @brief Convenience: open() then instantiate().
+   * @return The map, or nothing if the file could not be used.
+   */
+  static std::optional<GeneratedMap> Load(const std::string &file);
+
+private:
+  MappedFile data;
+};
@@ -1,6 +1,11 @@
 #pragma once
-#include "entities/map/Waypoint.hpp"
+#include "entities/map/Path.hpp"
 #include "raylib.h"
+#include <algorithm>
+#include <functional>
+#include <span>
+#include <string>
+#include <utility>
 #include <vector>
 
 struct MapConfig {
@@ -8,6 +13,7 @@ struct MapConfig {
   int largeParkingCount = 1;
   int smallChargingCount = 1;
   int largeChargingCount = 0;
+  std::string snapshotPath; ///< Load this WorldSnapshot instead of generating (empty: generate)
 };
 
 enum class SceneType { MainMenu, MapConfig, Game };
@@ -16,22 +22,55 @@ struct SceneChangeEvent {
   MapConfig config;
 };
 
+/// Published once a scene has finished loading and is about to be shown.
+struct SceneLoadedEvent {
+  SceneType scene;
+};
+
 struct GenerateWorldEvent {
   MapConfig config;
 };
 
+/// Published by GameScene while a world is built in the background.
+struct WorldLoadProgressEvent {
+  float fraction; ///< 0 to 1
+};
+
+/// Saves the current world as a WorldSnapshot.
+struct SaveWorldEvent {
+  std::string path;
+};
+
 struct WorldBoundsEvent {
   float width;
   float height;
 };
 
+/// Published by GameScene after each tick; the simulation itself runs on its SystemScheduler.
 struct GameUpdateEvent {
   double dt;
 };
 
 struct BeginCameraEvent {};
 struct EndCameraEvent {};
-struct DrawWorldEvent {};
+/// Rendering detail tier, picked from the camera zoom (see Config::Render::LOD_*).
+enum class RenderLod { NEAR, MID, FAR };
+
+/// Carries the World Space area (Meters) visible through the camera, the detail tier to draw it at,
+/// the list subscribers record into (submitted by GameScene inside the camera), and the
+/// interpolation alpha to blend moving entities between their last two ticks with.
+struct DrawWorldEvent {
+  Rectangle visibleArea;
+  RenderLod lod = RenderLod::NEAR;
+  class DrawList *drawList = nullptr;
+  float alpha = 1.0f;
+};
+
+/// Published once per frame before the window's render target is bound (off-screen passes go here).
+/// Carries the fraction of a tick elapsed since the last update (see GameLoop::run).
+struct PreRenderEvent {
+  float alpha = 1.0f;
+};
 
 struct GamePausedEvent {};
 struct GameResumedEvent {};
@@ -55,6 +94,12 @@ struct AutoSpawnLevelChangedEvent {
 
 struct SpawnCarRequestEvent {};
 
+/// Switches through-traffic between individual cars and the mesoscopic RoadFlow model.
+struct ToggleFlowModelEvent {};
+struct FlowModelChangedEvent {
+  bool mesoscopic;
+};
+
 struct CreateCarEvent {
   Vector2 position;
   Vector2 velocity; // Initial velocity (sets heading)
@@ -67,9 +112,10 @@ struct CarSpawnedEvent {
   class Car *car;
 };
 
+/// Hands a car a shared path (the handle is copied, never the waypoints).
 struct AssignPathEvent {
   class Car *car;
-  std::vector<struct Waypoint> path;
+  PathHandle path;
 };
 
 struct CarFinishedParkingEvent {
@@ -80,6 +126,44 @@ struct CarDespawnEvent {
   class Car *car;
 };
 
+/**
+ * @brief Car storage was re-sorted (EntityManager::reorderCars) and every car moved to a new address.
+ *
+ * Published while the old cars still exist; whoever keeps Car pointers swaps them for the new ones.
+ */
+struct CarsRelocatedEvent {
+  std::span<const std::pair<class Car *, class Car *>> moves; ///< (old, new), sorted by old address
+
+  /// New address of a car, or the pointer unchanged if it did not move.
+  class Car *relocated(class Car *car) const {
+    auto it = std::lower_bound(moves.begin(), moves.end(), car,
+                               [](const auto &move, class Car *old) { return std::less<>{}(move.first, old); });
+    return (it != moves.end() && it->first == car) ? it->second : car;
+  }
+};
+
+struct SpotStateChangedEvent {
+  class Module *module;
+  int spotIndex;
+};
+
+/// Facility occupancy over the whole map, sampled by the StatisticsSystem (Config::Schedule::STATISTICS_HZ).
+struct OccupancyStatsEvent {
+  int parkingLots = 0;
+  int chargingStations = 0;
+  int parkingSpots = 0;
+  int occupiedParking = 0;
+  int chargingSpots = 0;
+  int occupiedCharging = 0;
+};
+
+/// Sound effects played by the AudioSystem.
+enum class SoundEffect { CLICK };
+
+struct PlaySoundEvent {
+  SoundEffect sound;
+};
+
 struct SimulationSpeedChangedEvent {
   double speedMultiplier;
 };
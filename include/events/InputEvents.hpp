@@ -14,3 +14,7 @@ struct MouseClickEvent {
 struct KeyReleasedEvent {
   int key;
 };
+
+struct MouseWheelEvent {
+  float move;
+};
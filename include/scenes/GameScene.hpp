@@ -1,15 +1,26 @@
 #pragma once
+#include "core/DrawList.hpp"
 #include "core/EventBus.hpp"
+#include "core/SystemScheduler.hpp"
 #include "events/GameEvents.hpp"
+#include "entities/map/WorldGenerator.hpp"
 #include "scenes/IScene.hpp"
+#include <atomic>
+#include <future>
 #include <memory>
 #include <set>
 #include <vector>
 
 class TrackingSystem;
+class ThreadPool;
 class GameScene : public IScene {
 public:
-  explicit GameScene(std::shared_ptr<EventBus> bus, MapConfig config);
+  /**
+   * @param bus EventBus for communication.
+   * @param config Map to generate (or snapshot to load).
+   * @param workers If set, the world is built there behind a loading screen; otherwise during load().
+   */
+  explicit GameScene(std::shared_ptr<EventBus> bus, MapConfig config, ThreadPool *workers = nullptr);
   ~GameScene() override;
 
   void load() override;
@@ -17,18 +28,36 @@ public:
   void update(double dt) override;
   void draw() override;
 
+  bool isLoading() const { return pendingMap.valid(); }
+
 private:
-  void handleInput();
+  /**
+   * @brief Hands the background-built map to the EntityManager once it is ready.
+   */
+  void pollPendingMap();
+  void drawLoadingScreen() const;
+
   std::unique_ptr<TrackingSystem> trackingSystem;
   std::shared_ptr<EventBus> eventBus;
   std::vector<Subscription> eventTokens;
 
   std::unique_ptr<class EntityManager> entityManager;
   std::unique_ptr<class TrafficSystem> trafficSystem;
+  std::unique_ptr<class StatisticsSystem> statisticsSystem;
+  SystemScheduler scheduler; ///< Runs the simulation systems, each at its own rate (Config::Schedule)
   std::unique_ptr<class GameHUD> gameHUD;
 
   std::unique_ptr<class CameraSystem> cameraSystem;
+
+  DrawList worldDrawList; ///< Recorded on DrawWorldEvent, submitted inside the camera
+  DrawList hudDrawList;   ///< Screen-space HUD
   bool isPaused = false;
+  float renderAlpha = 1.0f; ///< Fraction of a tick elapsed at this frame (from PreRenderEvent)
   MapConfig config;
   std::set<int> keysDown;
+
+  ThreadPool *workers = nullptr;
+  std::future<GeneratedMap> pendingMap;              ///< World being built on a worker (unload() waits for it)
+  std::shared_ptr<std::atomic<float>> loadProgress;  ///< Shared with the job, which may outlive the scene
+  float reportedProgress = -1.0f;
 };
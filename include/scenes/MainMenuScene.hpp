@@ -1,4 +1,5 @@
 #pragma once
+#include "core/AssetManager.hpp"
 #include "scenes/IScene.hpp"
 #include "ui/UIManager.hpp"
 /**
@@ -41,4 +42,5 @@ public:
 private:
   std::shared_ptr<EventBus> eventBus; ///< EventBus for communication.
   UIManager ui;                       ///< UI Manager for the menu.
+  TextureHandle background = INVALID_TEXTURE; ///< Resolved in load().
 };
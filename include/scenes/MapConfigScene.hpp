@@ -1,4 +1,5 @@
 #pragma once
+#include "core/AssetManager.hpp"
 #include "events/GameEvents.hpp"
 #include "scenes/IScene.hpp"
 #include "ui/UIManager.hpp"
@@ -16,4 +17,5 @@ private:
   std::shared_ptr<EventBus> eventBus;
   UIManager ui;
   MapConfig config;
+  TextureHandle background = INVALID_TEXTURE;
 };
@@ -4,6 +4,8 @@
 #include "scenes/IScene.hpp"
 #include <memory>
 
+class ThreadPool;
+
 /**
  * @class SceneManager
  * @brief Manages the active game scene and transitions.
@@ -17,8 +19,9 @@ public:
    * @brief Constructs the SceneManager.
    *
    * @param bus Shared pointer to the EventBus.
+   * @param workers Pool scenes may run long jobs on (world generation); null runs them inline.
    */
-  explicit SceneManager(std::shared_ptr<EventBus> bus);
+  explicit SceneManager(std::shared_ptr<EventBus> bus, ThreadPool *workers = nullptr);
 
   /**
    * @brief Destructor.
@@ -49,6 +52,7 @@ public:
 private:
   std::shared_ptr<EventBus> eventBus;   ///< EventBus for communication.
   std::unique_ptr<IScene> currentScene; ///< The currently active scene.
+  ThreadPool *workers = nullptr;         ///< Owned by Application.
 
   Subscription sceneChangeToken; ///< Token for scene change event subscription.
 
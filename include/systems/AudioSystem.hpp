@@ -0,0 +1,63 @@
+#pragma once
+#include "core/EventBus.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @class AudioSystem
+ * @brief Owns the audio device, the background music and the UI sounds on a dedicated thread.
+ *
+ * Device initialisation, MP3 decoding and music buffering (UpdateMusicStream) all run on the
+ * audio thread, so neither startup nor the fixed-update tick waits on audio. Every raylib
+ * audio call is made from that thread; the rest of the game only posts requests
+ * (PlaySoundEvent, setMuted()) which the feed loop picks up.
+ */
+class AudioSystem {
+public:
+  /**
+   * @brief Starts the audio thread and subscribes to sound requests.
+   * @param bus EventBus carrying PlaySoundEvent.
+   */
+  explicit AudioSystem(std::shared_ptr<EventBus> bus);
+
+  /**
+   * @brief Stops the feed loop, unloads all audio and closes the device.
+   */
+  ~AudioSystem();
+
+  AudioSystem(const AudioSystem &) = delete;
+  AudioSystem &operator=(const AudioSystem &) = delete;
+
+  /**
+   * @brief Mutes or unmutes all audio (applied by the audio thread).
+   */
+  void setMuted(bool muted);
+
+  /**
+   * @brief Whether the device is up and the sounds are loaded (requests before that are dropped).
+   */
+  bool isReady() const { return ready; }
+
+private:
+  /**
+   * @brief Audio thread body: init, feed loop, shutdown.
+   */
+  void run();
+
+  std::shared_ptr<EventBus> eventBus;
+  std::vector<Subscription> eventTokens;
+
+  std::thread thread;
+  std::mutex mutex;             ///< Guards the request fields below
+  std::condition_variable wake; ///< Wakes the feed loop early for requests and shutdown
+  bool stopping = false;
+  bool muted = false;
+  bool muteChanged = false; ///< The device starts at its default volume until the mute button is used
+  int pendingClicks = 0;
+
+  std::atomic<bool> ready{false};
+};
@@ -1,5 +1,7 @@
 #pragma once
 #include "core/EventBus.hpp"
+#include "core/SystemScheduler.hpp"
+#include "events/GameEvents.hpp"
 #include "raylib.h"
 #include <memory>
 #include <set>
@@ -30,6 +32,11 @@ public:
    */
   void update(double dt);
 
+  /**
+   * @brief Registers the "camera" system (panning, every tick; writes SimState::CAMERA only).
+   */
+  void schedule(SystemScheduler &scheduler);
+
   /**
    * @brief Sets the world limits to prevent the camera from straying too far.
    * @param width World width in Meters.
@@ -38,13 +45,30 @@ public:
   void setWorldBounds(float width, float height);
 
   /**
-   * @brief Gets the underlying Raylib camera object.
+   * @brief Gets the camera as drawn this frame (target blended between the last two ticks).
    * @return Camera2D struct.
    */
-  Camera2D getCamera() const { return camera; }
+  Camera2D getCamera() const;
+
+  /**
+   * @brief Sets how far between the previous and the current tick the frame is drawn.
+   * @param alpha 0 = previous tick, 1 = current tick.
+   */
+  void setRenderAlpha(float alpha) { renderAlpha = alpha; }
+
+  /**
+   * @brief Computes the World Space area covered by the logical render target.
+   * @return Visible rectangle in Meters.
+   */
+  Rectangle getVisibleArea() const;
+
+  /**
+   * @brief Picks the rendering detail tier for the current zoom.
+   */
+  RenderLod getLod() const;
 
   // Setters for initial setup
-  void setTarget(Vector2 target) { camera.target = target; }
+  void setTarget(Vector2 target) { camera.target = previousTarget = target; }
   void setOffset(Vector2 offset) { camera.offset = offset; }
   void setZoom(float zoom) { camera.zoom = zoom; }
 
@@ -53,6 +77,8 @@ private:
   std::vector<Subscription> eventTokens;
 
   Camera2D camera = {{0, 0}, {0, 0}, 0.0f, 1.0f};
+  Vector2 previousTarget = {0, 0}; ///< Target before the last tick's panning
+  float renderAlpha = 1.0f;
 
   float worldWidth = 0.0f;
   float worldHeight = 0.0f;
@@ -29,6 +29,43 @@ public:
   static std::vector<Waypoint> GenerateExitPath(const Car *car, const Module *currentFac, const Spot &currentSpot,
                                                 bool exitRight, float finalX);
 
+  // --- Path pieces ---
+  // Everything but the approach to the road entry only depends on the facility, spot and lane,
+  // so RouteTable precomputes it; the approach is built per car.
+
+  /**
+   * @brief Main road lane a car drives in, from its heading (right -> DOWN, left -> UP).
+   */
+  static Lane MainRoadLane(const Car *car);
+
+  /**
+   * @brief Point on the main road where a car in the given lane turns off towards the facility.
+   */
+  static Waypoint RoadEntryPoint(const Module *targetFac, Lane mainRoadLane);
+
+  /**
+   * @brief Appends the drive from a car's position to the road entry point (HIGHWAY, then APPROACH).
+   */
+  static void AppendApproach(std::vector<Waypoint> &path, Vector2 from, const Waypoint &roadEntry);
+
+  /**
+   * @brief Appends road entry -> gate -> alignment point -> spot.
+   */
+  static void AppendParkingRoute(std::vector<Waypoint> &path, const Module *targetFac, const Spot &targetSpot,
+                                 const Waypoint &roadEntry);
+
+  /**
+   * @brief Appends the reverse out of the spot to its alignment point.
+   */
+  static void AppendUnpark(std::vector<Waypoint> &path, const Module *currentFac, const Spot &currentSpot);
+
+  /**
+   * @brief Appends alignment point -> gate -> road -> map edge.
+   * @param fallbackY Lane Y used when the facility has no parent road.
+   */
+  static void AppendExitRoute(std::vector<Waypoint> &path, const Module *currentFac, bool exitRight, float finalX,
+                              float fallbackY);
+
 private:
   /**
    * @brief Calculates the entry waypoint on the road leading to the facility.
@@ -59,8 +96,7 @@ private:
   static Waypoint CalculateSpotPoint(const Module *facility, const Spot &spot);
 
   /**
-   * @brief Adds a segment of waypoints from start to target, subdividing based on the Phase config.
+   * @brief Adds the straight segment from start to target, tagged with the Phase's speed and tolerance.
    */
-  static void AddSegment(std::vector<Waypoint> &path, Vector2 startPos, Waypoint target,
-                         const Config::CarAI::AIPhase &phase);
+  static void AddSegment(std::vector<Waypoint> &path, Waypoint target, const Config::CarAI::AIPhase &phase);
 };
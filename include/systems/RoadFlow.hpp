@@ -0,0 +1,83 @@
+#pragma once
+#include "core/DrawList.hpp"
+#include "entities/map/Modules.hpp"
+#include "raylib.h"
+#include <memory>
+#include <vector>
+
+/**
+ * @class RoadFlow
+ * @brief Mesoscopic model of the through-traffic on the main road.
+ *
+ * Each direction of the main road is a link cut into cells holding a (fractional) number of
+ * vehicles. Every step moves vehicles from cell to cell with the cell transmission model: a
+ * cell sends min(free speed * density, capacity) and the next cell receives what its remaining
+ * room allows (triangular fundamental diagram, Config::Flow). Vehicles that cannot enter yet
+ * wait in a point queue at the link entry.
+ *
+ * The cost of a step depends on the road length only, not on the number of vehicles, so
+ * volumes far beyond what individual Car agents could handle stay cheap.
+ */
+class RoadFlow {
+public:
+  /**
+   * @brief Lays out the links along the main road (the row of the first road module).
+   * @param modules The world's modules.
+   */
+  void build(const std::vector<std::unique_ptr<Module>> &modules);
+
+  /**
+   * @brief Removes links and vehicles.
+   */
+  void clear();
+
+  /**
+   * @brief Queues vehicles at the entry of a link.
+   * @param towardsRight Link driving towards +X (entered on the left), else towards -X.
+   * @param count Number of vehicles (fractions accumulate).
+   */
+  void addVehicles(bool towardsRight, float count = 1.0f);
+
+  /**
+   * @brief Advances the flow by one step.
+   * @param dt Step in seconds.
+   */
+  void step(float dt);
+
+  /**
+   * @brief Records every non-empty visible cell as a tint from green (free) to red (jammed).
+   */
+  void draw(Rectangle view, DrawList &out) const;
+
+  bool isBuilt() const { return !links.empty(); }
+
+  /// No vehicle on the road or waiting to enter.
+  bool isEmpty() const { return getVehiclesOnRoad() + getQueuedVehicles() < 0.01f; }
+
+  float getVehiclesOnRoad() const;
+  float getQueuedVehicles() const;
+  double getExitedVehicles() const;
+  std::size_t getCellCount() const { return links.empty() ? 0 : links.front().cells.size(); }
+
+  /**
+   * @brief Vehicles per meter in a cell (cells are numbered in driving order).
+   */
+  float getDensity(bool towardsRight, std::size_t cell) const;
+
+private:
+  struct Link {
+    float y;                  ///< Lane line (Meters)
+    bool towardsRight;        ///< Cell 0 is at the left end when true, at the right end otherwise
+    std::vector<float> cells; ///< Vehicles per cell
+    float queue = 0.0f;       ///< Vehicles waiting to enter
+    double exited = 0.0;      ///< Vehicles that left the road so far
+  };
+
+  Link *find(bool towardsRight);
+  const Link *find(bool towardsRight) const;
+
+  std::vector<Link> links;
+  std::vector<float> transfers; ///< Scratch: vehicles moving out of each cell this step
+  float minX = 0.0f;
+  float cellLength = 0.0f; ///< Meters (the road length split evenly)
+};
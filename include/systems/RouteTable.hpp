@@ -0,0 +1,71 @@
+#pragma once
+#include "entities/map/Modules.hpp"
+#include "entities/map/Path.hpp"
+#include "entities/map/Waypoint.hpp"
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @class RouteTable
+ * @brief Every parking and exit route of a world, computed once when the world is built.
+ *
+ * Per facility spot it holds the two parking routes (one per main road lane, from the road
+ * entry to the spot) and the two exit routes (from the alignment point to either map edge).
+ * All waypoints live back to back in one array; a route is an offset and a count into it.
+ *
+ * Exit paths do not depend on the car at all and are handed out as shared Paths. Parking paths
+ * only need the approach from the car's position built per car; the returned Path borrows the
+ * stored route as its tail. Paths keep the array alive even if the table is rebuilt for another world.
+ */
+class RouteTable {
+public:
+  /**
+   * @brief Computes the routes of every facility spot and the road span.
+   * @param modules The world's modules (facilities must not move afterwards).
+   */
+  void build(const std::vector<std::unique_ptr<Module>> &modules);
+
+  void clear();
+
+  /**
+   * @brief Full parking path for a car: approach from its position, then the stored route.
+   * @return Null if the facility or spot is not in the table.
+   */
+  PathHandle entryPath(Vector2 from, const Module *facility, int spotIndex, Lane lane) const;
+
+  /**
+   * @brief Exit path from a spot: reverse to the alignment point, then out to a map edge.
+   * @return The shared path (no allocation), or null if the facility or spot is not in the table.
+   */
+  PathHandle exitPath(const Module *facility, int spotIndex, bool exitRight) const;
+
+  // Horizontal extent of the main road (Meters); cars leave 2m beyond it
+  float getMinRoadX() const { return minRoadX; }
+  float getMaxRoadX() const { return maxRoadX; }
+
+  std::size_t getWaypointCount() const { return waypoints ? waypoints->size() : 0; }
+
+private:
+  struct Route {
+    std::uint32_t first = 0; ///< Index of the first waypoint
+    std::uint32_t count = 0;
+  };
+
+  /// Routes of one spot, indexed by Lane (entry) and by exitRight (exit).
+  struct SpotRoutes {
+    Waypoint roadEntry[2] = {Waypoint({0, 0}), Waypoint({0, 0})};
+    Route entry[2];
+    PathHandle exit[2];
+  };
+
+  const SpotRoutes *find(const Module *facility, int spotIndex) const;
+  PathHandle makePath(std::vector<Waypoint> lead, Route route) const;
+
+  std::shared_ptr<const std::vector<Waypoint>> waypoints; ///< Every route, back to back (shared with paths)
+  std::vector<SpotRoutes> spots;
+  std::unordered_map<const Module *, std::uint32_t> firstSpot; ///< Facility -> index of its spot 0 in spots
+  float minRoadX = 0.0f;
+  float maxRoadX = 100.0f;
+};
@@ -0,0 +1,34 @@
+#pragma once
+#include "core/EntityManager.hpp"
+#include "core/EventBus.hpp"
+#include "core/SystemScheduler.hpp"
+#include "events/GameEvents.hpp"
+#include <memory>
+
+/**
+ * @class StatisticsSystem
+ * @brief Samples facility occupancy at a low rate and publishes it (OccupancyStatsEvent).
+ *
+ * Readers (the dashboard) show the last sample instead of walking every facility each frame.
+ */
+class StatisticsSystem {
+public:
+  StatisticsSystem(std::shared_ptr<EventBus> bus, const EntityManager &entityManager);
+
+  /**
+   * @brief Registers the "statistics" system at Config::Schedule::STATISTICS_HZ.
+   */
+  void schedule(SystemScheduler &scheduler);
+
+  /**
+   * @brief Counts spots and occupied spots per facility kind and publishes the totals.
+   */
+  void update(double dt);
+
+  const OccupancyStatsEvent &getLatest() const { return latest; }
+
+private:
+  std::shared_ptr<EventBus> eventBus;
+  const EntityManager &entityManager;
+  OccupancyStatsEvent latest;
+};
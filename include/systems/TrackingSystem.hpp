@@ -1,5 +1,6 @@
 #pragma once
 #include "core/EventBus.hpp"
+#include "core/SystemScheduler.hpp"
 #include "entities/Car.hpp"
 #include <memory>
 #include <vector>
@@ -11,6 +12,17 @@ public:
 
     void update(double dt);
 
+    /**
+     * @brief Registers the "tracking" system (every tick; reads the cars, stopping moves the camera).
+     */
+    void schedule(SystemScheduler &scheduler);
+
+    /**
+     * @brief Centres the camera on the tracked car as drawn this frame.
+     * @param alpha Interpolation between the previous (0) and the current (1) tick.
+     */
+    void follow(float alpha);
+
 private:
     std::shared_ptr<EventBus> eventBus;
     std::vector<Subscription> eventTokens;
@@ -18,6 +30,8 @@ private:
     Car* targetCar = nullptr;
     bool isTrackingActive = false;
     bool waitingForSpawn = false;
+    Vector2 lastFollowed = {0, 0}; ///< Last position sent to the camera
+    bool hasFollowed = false;
 
     void startTracking();
     void stopTracking();
@@ -1,6 +1,9 @@
 #pragma once
 #include "core/EntityManager.hpp"
 #include "core/EventBus.hpp"
+#include "core/SystemScheduler.hpp"
+#include "systems/RoadFlow.hpp"
+#include "systems/RouteTable.hpp"
 #include <memory>
 #include <vector>
 
@@ -13,6 +16,10 @@
  * - Assigning parking spots and paths to cars.
  * - Monitoring car states (Parking, Exiting).
  * - Cleaning up cars that have exited the map.
+ * - Optionally (mesoscopic mode), modelling through-traffic as a flow (RoadFlow) rather than cars.
+ *
+ * The work is split by how often it has to run (see schedule() and Config::Schedule): flow and
+ * spot arrivals every tick, spawning a few times per second, and parked cars once per second.
  */
 class TrafficSystem {
 public:
@@ -24,13 +31,63 @@ public:
   TrafficSystem(std::shared_ptr<EventBus> bus, const EntityManager &entityManager);
   ~TrafficSystem();
 
+  /**
+   * @brief Registers the traffic, spawner and parking systems at their Config::Schedule rates.
+   */
+  void schedule(SystemScheduler &scheduler);
+
+  /**
+   * @brief Steps through-traffic flow, marks reached spots occupied and removes cars that left the map.
+   */
+  void update(double dt);
+
+  /**
+   * @brief Advances the auto-spawn timer (and background flow demand in mesoscopic mode).
+   */
+  void updateSpawner(double dt);
+
+  /**
+   * @brief Counts down parked cars, charges electric ones and decides which of them leave.
+   * @param dt Time since the last call; charge and exit chances scale with it.
+   */
+  void updateParking(double dt);
+
 private:
   std::shared_ptr<EventBus> eventBus;
   const EntityManager &entityManager;
   std::vector<Subscription> eventTokens;
+  RouteTable routes; ///< Rebuilt whenever a new world is installed (WorldBoundsEvent)
+  RoadFlow flow;     ///< Through-traffic in mesoscopic mode (laid out with the routes)
+  bool mesoscopic = false;
+
+  int freeParkingSpots = 0;  ///< Free spots over all parking lots (see setSpotState())
+  int freeChargingSpots = 0; ///< Free spots over all charging stations
 
   int currentSpawnLevel = 0;
   float spawnTimer = 0.0f;
 
   void spawnCar();
+
+  /**
+   * @brief In mesoscopic mode, turns a car that could not park anywhere into flow on the main road.
+   * @param electric Whether the car may also use charging stations.
+   * @param towardsRight Direction of travel (entered on the left).
+   * @return True if the car joined the flow and must not be created.
+   */
+  bool divertToFlow(bool electric, bool towardsRight);
+
+  /**
+   * @brief Recounts the free spots of a newly installed map.
+   */
+  void countFreeSpots();
+
+  /**
+   * @brief The free-spot total a facility counts towards (nullptr for roads).
+   */
+  int *freeSpotCounter(const Module &facility);
+
+  /**
+   * @brief Changes a spot's state, keeps the free-spot totals and announces it (SpotStateChangedEvent).
+   */
+  void setSpotState(Module *facility, int spotIndex, SpotState state);
 };
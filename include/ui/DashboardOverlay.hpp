@@ -7,7 +7,9 @@
 #include "core/EntityManager.hpp"
 #include "core/EventBus.hpp"
 #include "events/GameEvents.hpp"
+#include "ui/UICache.hpp"
 #include "ui/UIElement.hpp"
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -19,6 +21,10 @@
  * - General Simulator stats (FPS, Entity count).
  * - Selected Car details.
  * - Facility occupancy and economics.
+ *
+ * The panel is rendered into a UICache and only re-recorded when the values it shows change
+ * (selection, the EntityManager stats version, a new occupancy sample, or the selected car's
+ * displayed readings). General occupancy comes from OccupancyStatsEvent, not from walking the map.
  */
 class DashboardOverlay : public UIElement {
 public:
@@ -26,18 +32,44 @@ public:
   ~DashboardOverlay();
 
   void update(double dt) override;
-  void draw() override;
+  void draw(DrawList &out) override;
+  using UIElement::draw;
 
 private:
   EntityManager *entityManager;
   std::vector<Subscription> eventTokens;
 
   EntitySelectedEvent currentSelection;
+  OccupancyStatsEvent occupancy;       ///< Latest sample (StatisticsSystem)
+  std::uint64_t occupancySample = 0; ///< Samples received
+
+  /**
+   * @brief Everything the panel's content depends on; a change means the cache is stale.
+   */
+  struct ContentKey {
+    SelectionType type = SelectionType::GENERAL;
+    const void *subject = nullptr;
+    int spotIndex = -1;
+    std::uint64_t statsVersion = 0;
+    std::uint64_t occupancySample = 0;
+    int carState = 0;
+    long speedTenths = 0;   ///< Car speed as displayed (one decimal).
+    long batteryTenths = 0; ///< Battery level as displayed (one decimal).
+
+    bool operator==(const ContentKey &) const = default;
+  };
+
+  UICache cache;
+  ContentKey cachedKey;
+
+  ContentKey currentKey() const;
+  Rectangle panelArea() const;
+  void recordPanel(DrawList &out);
 
-  void drawGeneralInfo(int x, int y, int width);
-  void drawCarInfo(int x, int y, int width);
-  void drawFacilityInfo(int x, int y, int width);
-  void drawSpotInfo(int x, int y, int width);
+  void drawGeneralInfo(DrawList &out, int x, int y, int width);
+  void drawCarInfo(DrawList &out, int x, int y, int width);
+  void drawFacilityInfo(DrawList &out, int x, int y, int width);
+  void drawSpotInfo(DrawList &out, int x, int y, int width);
 
   bool visible = true;
 };
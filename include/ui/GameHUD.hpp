@@ -5,6 +5,7 @@
  * @brief Main Heads-Up Display manager.
  */
 #include "core/EventBus.hpp"
+#include "ui/UICache.hpp"
 #include "ui/UIManager.hpp"
 #include <memory>
 #include <vector>
@@ -23,7 +24,11 @@ public:
   ~GameHUD();
 
   void update(double dt);
-  void draw();
+
+  /**
+   * @brief Records the HUD (buttons, dashboard, hints) into a screen-space draw list.
+   */
+  void draw(DrawList &out);
 
 private:
   std::shared_ptr<EventBus> eventBus;
@@ -32,4 +37,8 @@ private:
 
   bool isPaused = false;
   double currentSpeed = 1.0;
+
+  // Static HUD text never changes, so it is rasterised once
+  UICache hintCache;
+  UICache pausedCache;
 };
@@ -4,6 +4,7 @@
  * @file UIButton.hpp
  * @brief Simple UI Button component.
  */
+#include "ui/UICache.hpp"
 #include "ui/UIElement.hpp"
 #include <functional>
 #include <string>
@@ -13,6 +14,7 @@
  * @brief A clickable button UI element.
  *
  * Handles mouse hover and click events to trigger a callback.
+ * The rendered button is cached and only re-rendered when its text or hover/press state changes.
  */
 class UIButton : public UIElement {
 public:
@@ -27,7 +29,8 @@ public:
   UIButton(Vector2 pos, Vector2 size, const std::string &text, std::shared_ptr<EventBus> bus);
 
   void update(double dt) override;
-  void draw() override;
+  void draw(DrawList &out) override;
+  using UIElement::draw;
 
 
    /**
@@ -49,8 +52,17 @@ public:
   void setOnClick(std::function<void()> cb);
 
 private:
+  /**
+   * @brief Records the button body, border and label.
+   */
+  void recordContent(DrawList &out) const;
+
   std::string text;              ///< Button label text.
   std::function<void()> onClick; ///< Click callback.
   bool isHovered = false;        ///< Hover state.
   bool isPressed = false;        ///< Pressed state.
+
+  UICache cache;                 ///< Rendered button.
+  bool cachedHovered = false;    ///< Hover state the cache was rendered with.
+  bool cachedPressed = false;    ///< Pressed state the cache was rendered with.
 };
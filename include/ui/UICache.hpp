@@ -0,0 +1,56 @@
+#pragma once
+#include "core/DrawList.hpp"
+#include "raylib.h"
+#include <functional>
+
+/**
+ * @class UICache
+ * @brief Render-texture cache for a rarely changing piece of UI.
+ *
+ * The owner records its content once into the texture (refresh()) and then draws it as a
+ * single quad every frame (draw()) until invalidate() is called. Owners decide when content
+ * is stale (dirty flag or version counter) and refresh on PreRenderEvent, because rendering
+ * into the texture cannot happen while the window's render target is bound.
+ *
+ * The texture is baked with premultiplied alpha so translucent panels and anti-aliased text
+ * composite exactly as if they had been drawn directly.
+ */
+class UICache {
+public:
+  /// Records the content in screen coordinates (the area passed to refresh() maps onto the texture).
+  using RecordFn = std::function<void(DrawList &out)>;
+
+  UICache() = default;
+  ~UICache();
+
+  UICache(const UICache &) = delete;
+  UICache &operator=(const UICache &) = delete;
+
+  /**
+   * @brief Marks the cached content stale.
+   */
+  void invalidate() { dirty = true; }
+
+  /**
+   * @brief Whether the texture holds up-to-date content.
+   */
+  bool isReady() const { return !dirty && target.id != 0; }
+
+  /**
+   * @brief Re-renders the content if stale. Call outside any BeginTextureMode() block.
+   * @param area Screen area covered by the content (logical pixels).
+   * @param record Callback recording the content.
+   */
+  void refresh(Rectangle area, const RecordFn &record);
+
+  /**
+   * @brief Records the cached texture at the area it was rendered for.
+   */
+  void draw(DrawList &out) const;
+
+private:
+  RenderTexture2D target = {};
+  Rectangle area = {0, 0, 0, 0};
+  DrawList list;
+  bool dirty = true;
+};
@@ -1,4 +1,5 @@
 #pragma once
+#include "core/DrawList.hpp"
 #include "core/EventBus.hpp"
 #include "raylib.h"
 #include <memory>
@@ -32,9 +33,19 @@ public:
   virtual void update(double dt) = 0;
 
   /**
-   * @brief Draws the UI element.
+   * @brief Records the UI element into a draw list.
+   * @param out Draw list to record into.
    */
-  virtual void draw() = 0;
+  virtual void draw(DrawList &out) = 0;
+
+  /**
+   * @brief Draws the UI element immediately.
+   */
+  void draw() {
+    DrawList list;
+    draw(list);
+    list.submit();
+  }
 
   /**
    * @brief Checks if the element is visible/active.
@@ -29,10 +29,16 @@ public:
   /**
    * @brief Draws all active UI elements.
    */
-  void draw() {
+  void draw(DrawList &out) {
     for (auto &e : elements)
       if (e->isActive())
-        e->draw();
+        e->draw(out);
+  }
+
+  void draw() {
+    DrawList list;
+    draw(list);
+    list.submit();
   }
 
 private:
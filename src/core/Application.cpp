@@ -17,19 +17,14 @@
   Application::Application() {
   Logger::Info("Application Starting...");
 
-  InitAudioDevice();
-  backgroundMusic = LoadMusicStream("assets/background_music.mp3");
-  if (backgroundMusic.stream.buffer != nullptr) {
-    PlayMusicStream(backgroundMusic);
-    SetMusicVolume(backgroundMusic, 0.1f); // Low volume level
-    musicLoaded = true;
-  }
-  
   // Initialize core systems
   eventBus = std::make_shared<EventBus>();
+  audioSystem = std::make_unique<AudioSystem>(eventBus); // Device and music come up on the audio thread
+  redrawTracker = std::make_unique<RedrawTracker>(eventBus);
   window = std::make_unique<Window>(eventBus);
+  threadPool = std::make_unique<ThreadPool>();
   inputSystem = std::make_unique<InputSystem>(eventBus, *window);
-  sceneManager = std::make_unique<SceneManager>(eventBus);
+  sceneManager = std::make_unique<SceneManager>(eventBus, threadPool.get());
   eventLogger = std::make_unique<EventLogger>(eventBus);
   gameLoop = std::make_unique<GameLoop>();
 
@@ -41,24 +36,16 @@
     );
   muteButton->setOnClick([this]() {
         this->isMuted = !this->isMuted;
-    if (this->isMuted) {
-        SetMasterVolume(0.0f); 
-    } else {
-        SetMasterVolume(0.5f); 
-    }
+        this->audioSystem->setMuted(this->isMuted);
     });
 
+  // Every texture in the manifest: from the pre-decoded pack if the build produced one,
+  // otherwise images decoded on the workers; uploads happen here
   auto &AM = AssetManager::Get();
-  AM.LoadTexture("menu_bg", "assets/menu_background.png");
-  AM.LoadTexture("config_bg", "assets/config_background.png");
-
-  // تحميل أصول القائمة مسبقاً
-  AM.LoadTexture("menu_bg", "assets/menu_background.png");
-  AM.LoadTexture("config_bg", "assets/config_background.png");
-  
-  // أضف هذه الأسطر هنا لضمان ظهورها من البداية
-  AM.LoadTexture("sound_on", "assets/sound_on.png");
-  AM.LoadTexture("sound_off", "assets/volume-mute.png");
+  AM.MountPack(Config::ASSET_PACK_PATH);
+  AM.LoadManifest(AssetManifest::TEXTURES, *threadPool);
+  soundOnIcon = AM.GetTextureHandle("sound_on");
+  soundOffIcon = AM.GetTextureHandle("sound_off");
 
   // Start with the main menu
   sceneManager->setScene(SceneType::MainMenu);
@@ -82,21 +69,13 @@
 }
 
 Application::~Application() {
-    if (musicLoaded) {
-        UnloadMusicStream(backgroundMusic);
-    }
-    CloseAudioDevice(); 
     Logger::Info("Application Stopped Safely");
 }
 
 void Application::run() {
     gameLoop->run(
-        [this](double dt) { 
-            // Update music stream every frame to ensure it keeps playing
-            if (this->musicLoaded) UpdateMusicStream(this->backgroundMusic); 
-            this->update(dt); 
-        }, 
-        [this]() { this->render(); }, 
+        [this](double dt) { this->update(dt); }, 
+        [this](double alpha) { this->render(alpha); }, 
         [this]() { return isRunning; }
     );
 }
@@ -105,12 +84,24 @@ void Application::update(double dt) {
   sceneManager->update(dt);
 }
 
-void Application::render() {
+void Application::render(double alpha) {
   if (window->shouldClose()) {
     eventBus->publish(WindowCloseEvent{});
   }
   inputSystem->update();
 
+  // Nothing on screen changed: keep polling input, but skip the frame and sleep
+  if (IsWindowResized())
+    redrawTracker->requestRedraw();
+  if (!redrawTracker->shouldRender()) {
+    PollInputEvents(); // Normally done by EndDrawing()
+    WaitTime(Config::Render::IDLE_POLL_INTERVAL);
+    return;
+  }
+
+  // Off-screen passes (e.g. static layer baking) must run before the window's render target is bound
+  eventBus->publish(PreRenderEvent{(float)alpha});
+
   window->beginDrawing();
   sceneManager->render();
 
@@ -130,9 +121,8 @@ void Application::render() {
 
 void Application::DrawVolumeIcon(Vector2 pos, bool muted) {
     auto &AM = AssetManager::Get();
-    // اختيار اسم الصورة بناءً على حالة الكتم
-    std::string texName = muted ? "sound_off" : "sound_on";
-    Texture2D tex = AM.GetTexture(texName);
+    // اختيار الصورة بناءً على حالة الكتم
+    const Texture2D &tex = AM.GetTexture(muted ? soundOffIcon : soundOnIcon);
 
     if (tex.id > 0) {
         // تحديد حجم الأيقونة (مثلاً 30x30 بكسل) لتناسب الزر الذي حجمه 50x50 أو 55x55
@@ -1,15 +1,37 @@
 #include "core/AssetManager.hpp"
 #include "core/Logger.hpp"
+#include "core/ThreadPool.hpp"
+#include <algorithm>
+#include <chrono>
+#include <future>
 
 /**
  * @file AssetManager.cpp
  * @brief Implementation of AssetManager.
  */
 
+AssetManager::AssetManager() {
+  // Reserve the empty slot behind INVALID_TEXTURE
+  textureSlots.push_back({0, 0, 0, 0, 0});
+}
+
 AssetManager::~AssetManager() { UnloadAll(); }
 
+TextureHandle AssetManager::GetTextureHandle(const std::string &name) {
+  auto it = textureIds.find(name);
+  if (it != textureIds.end()) {
+    return it->second;
+  }
+
+  TextureHandle handle = static_cast<TextureHandle>(textureSlots.size());
+  textureSlots.push_back({0, 0, 0, 0, 0});
+  textureIds.emplace(name, handle);
+  return handle;
+}
+
 void AssetManager::LoadTexture(const std::string &name, const std::string &path) {
-  if (textures.find(name) != textures.end()) {
+  TextureHandle handle = GetTextureHandle(name);
+  if (textureSlots[handle].id != 0) {
     Logger::Warn("Texture already loaded: {}", name);
     return;
   }
@@ -20,32 +42,158 @@ void AssetManager::LoadTexture(const std::string &name, const std::string &path)
     return;
   }
 
-  textures[name] = tex;
+  textureSlots[handle] = tex;
   Logger::Info("Loaded texture: {}", name);
 }
 
+bool AssetManager::MountPack(const std::string &file) {
+  if (!pack.open(file)) {
+    Logger::Info("No asset pack at {}; decoding image files", file);
+    return false;
+  }
+  return true;
+}
+
+std::vector<AssetLoadTiming> AssetManager::LoadManifest(std::span<const AssetManifestEntry> entries,
+                                                       ThreadPool &pool) {
+  using Clock = std::chrono::steady_clock;
+  auto toMs = [](Clock::duration d) { return std::chrono::duration<double, std::milli>(d).count(); };
+  auto start = Clock::now();
+
+  // Group names by file so a path listed twice is only decoded and uploaded once
+  struct PathGroup {
+    std::string path;
+    std::vector<TextureHandle> handles;
+    std::string firstName;
+    const AssetPackEntry *packed = nullptr;
+  };
+  std::vector<PathGroup> groups;
+  for (const auto &entry : entries) {
+    TextureHandle handle = GetTextureHandle(std::string(entry.name));
+    if (textureSlots[handle].id != 0)
+      continue;
+
+    auto group = std::find_if(groups.begin(), groups.end(), [&](const PathGroup &g) { return g.path == entry.path; });
+    if (group == groups.end()) {
+      groups.push_back({std::string(entry.path), {}, std::string(entry.name), pack.find(entry.path)});
+      group = groups.end() - 1;
+    }
+    if (std::find(group->handles.begin(), group->handles.end(), handle) == group->handles.end()) {
+      group->handles.push_back(handle);
+    }
+  }
+
+  // Decode (file read + PNG inflate) on the workers, unless the pack already holds the texels
+  struct Decoded {
+    Image image;
+    double decodeMs;
+  };
+  std::vector<std::future<Decoded>> jobs(groups.size());
+  for (std::size_t i = 0; i < groups.size(); ++i) {
+    if (groups[i].packed)
+      continue;
+    jobs[i] = pool.submit([path = groups[i].path, toMs]() {
+      auto begin = Clock::now();
+      Image image = ::LoadImage(path.c_str());
+      return Decoded{image, toMs(Clock::now() - begin)};
+    });
+  }
+
+  // Upload on this thread (owns the GL context), in manifest order
+  std::vector<AssetLoadTiming> report;
+  report.reserve(groups.size());
+  for (std::size_t i = 0; i < groups.size(); ++i) {
+    const PathGroup &group = groups[i];
+    AssetLoadTiming timing{group.firstName, group.path};
+    Texture2D tex = {0, 0, 0, 0, 0};
+
+    if (group.packed) {
+      // Texels are read straight from the mapping
+      timing.packed = true;
+      auto begin = Clock::now();
+      tex = ::LoadTextureFromImage(pack.image(*group.packed));
+      timing.uploadMs = toMs(Clock::now() - begin);
+    } else {
+      Decoded decoded = jobs[i].get();
+      timing.decodeMs = decoded.decodeMs;
+      if (decoded.image.data == nullptr) {
+        Logger::Error("Failed to load texture: {}", group.path);
+        report.push_back(timing);
+        continue;
+      }
+
+      auto begin = Clock::now();
+      tex = ::LoadTextureFromImage(decoded.image);
+      ::UnloadImage(decoded.image);
+      timing.uploadMs = toMs(Clock::now() - begin);
+    }
+
+    if (tex.id == 0) {
+      Logger::Error("Failed to upload texture: {}", group.path);
+      report.push_back(timing);
+      continue;
+    }
+
+    for (TextureHandle handle : group.handles) {
+      textureSlots[handle] = tex;
+    }
+    timing.width = tex.width;
+    timing.height = tex.height;
+    timing.loaded = true;
+    report.push_back(timing);
+  }
+
+  // Startup timing report
+  double decodeTotal = 0;
+  double uploadTotal = 0;
+  for (const auto &timing : report) {
+    Logger::Info("  {:<20} {:>4}x{:<4} {} {:6.2f} ms  upload {:5.2f} ms", timing.name, timing.width,
+                 timing.height, timing.packed ? "pack  " : "decode", timing.decodeMs, timing.uploadMs);
+    decodeTotal += timing.decodeMs;
+    uploadTotal += timing.uploadMs;
+  }
+  Logger::Info("Loaded {} textures from {} files in {:.1f} ms ({} workers, decode {:.1f} ms, upload {:.1f} ms)",
+               entries.size(), report.size(), toMs(Clock::now() - start), pool.size(), decodeTotal, uploadTotal);
+
+  return report;
+}
+
 Texture2D AssetManager::GetTexture(const std::string &name) {
-  if (textures.find(name) == textures.end()) {
+  auto it = textureIds.find(name);
+  if (it == textureIds.end() || textureSlots[it->second].id == 0) {
     Logger::Warn("Texture not found: {}", name);
     // Return a default texture or empty
     return {0, 0, 0, 0, 0};
   }
-  return textures[name];
+  return textureSlots[it->second];
 }
 
 void AssetManager::UnloadTexture(const std::string &name) {
-  if (textures.find(name) != textures.end()) {
-    ::UnloadTexture(textures[name]);
-    textures.erase(name);
+  auto it = textureIds.find(name);
+  if (it != textureIds.end() && textureSlots[it->second].id != 0) {
+    releaseSlot(it->second);
     Logger::Info("Unloaded texture: {}", name);
   }
 }
 
+void AssetManager::releaseSlot(TextureHandle handle) {
+  Texture2D tex = textureSlots[handle];
+  textureSlots[handle] = {0, 0, 0, 0, 0};
+
+  // Names loaded from the same file share one GPU texture
+  bool shared = std::any_of(textureSlots.begin(), textureSlots.end(), [&](const Texture2D &t) { return t.id == tex.id; });
+  if (!shared) {
+    ::UnloadTexture(tex);
+  }
+}
+
 void AssetManager::UnloadAll() {
-  for (auto &pair : textures) {
-    ::UnloadTexture(pair.second);
+  // Slots (and therefore handles held by entities) survive; only the GPU textures go
+  for (TextureHandle handle = 0; handle < textureSlots.size(); ++handle) {
+    if (textureSlots[handle].id != 0) {
+      releaseSlot(handle);
+    }
   }
-  textures.clear();
 
   Logger::Info("Unloaded all assets.");
 }
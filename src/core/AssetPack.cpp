@@ -0,0 +1,127 @@
+#include "core/AssetPack.hpp"
+#include "core/Logger.hpp"
+#include <cstring>
+#include <fstream>
+
+/**
+ * @file AssetPack.cpp
+ * @brief Implementation of the pre-decoded texture pack.
+ */
+
+namespace {
+constexpr char MAGIC[4] = {'P', 'L', 'P', 'K'};
+constexpr std::uint64_t DATA_ALIGNMENT = 16;
+constexpr std::uint32_t MAX_IMAGE_SIDE = 16384; // Keeps the texel size computation within int
+
+std::uint64_t alignUp(std::uint64_t value) { return (value + DATA_ALIGNMENT - 1) & ~(DATA_ALIGNMENT - 1); }
+} // namespace
+
+bool AssetPack::Write(const std::string &file, std::span<const Source> images) {
+  AssetPackHeader header{};
+  std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.version = VERSION;
+  header.entryCount = static_cast<std::uint32_t>(images.size());
+
+  std::vector<AssetPackEntry> index(images.size());
+  std::uint64_t offset = alignUp(sizeof(AssetPackHeader) + images.size() * sizeof(AssetPackEntry));
+  for (std::size_t i = 0; i < images.size(); ++i) {
+    const Source &source = images[i];
+    if (source.path.size() > MAX_PATH_LENGTH) {
+      Logger::Error("Asset path too long for pack: {}", source.path);
+      return false;
+    }
+
+    AssetPackEntry &entry = index[i];
+    std::memcpy(entry.path, source.path.data(), source.path.size());
+    entry.width = static_cast<std::uint32_t>(source.width);
+    entry.height = static_cast<std::uint32_t>(source.height);
+    entry.format = static_cast<std::uint32_t>(source.format);
+    entry.offset = offset;
+    entry.size = source.texels.size();
+    offset = alignUp(offset + entry.size);
+  }
+
+  std::ofstream out(file, std::ios::binary | std::ios::trunc);
+  if (!out) {
+    Logger::Error("Cannot write asset pack: {}", file);
+    return false;
+  }
+
+  out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  out.write(reinterpret_cast<const char *>(index.data()), static_cast<std::streamsize>(index.size() * sizeof(AssetPackEntry)));
+  for (std::size_t i = 0; i < images.size(); ++i) {
+    // Zero padding up to the aligned offset
+    std::uint64_t position = static_cast<std::uint64_t>(out.tellp());
+    static const char padding[DATA_ALIGNMENT] = {};
+    out.write(padding, static_cast<std::streamsize>(index[i].offset - position));
+    out.write(reinterpret_cast<const char *>(images[i].texels.data()), static_cast<std::streamsize>(index[i].size));
+  }
+
+  return static_cast<bool>(out);
+}
+
+bool AssetPack::open(const std::string &file) {
+  close();
+  if (!data.open(file))
+    return false;
+
+  auto fail = [this, &file](const char *reason) {
+    Logger::Warn("Ignoring asset pack {}: {}", file, reason);
+    close();
+    return false;
+  };
+
+  AssetPackHeader header;
+  if (data.size() < sizeof(header))
+    return fail("truncated header");
+  std::memcpy(&header, data.data(), sizeof(header));
+  if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0)
+    return fail("not an asset pack");
+  if (header.version != VERSION)
+    return fail("unsupported version");
+
+  std::uint64_t indexEnd = sizeof(header) + std::uint64_t(header.entryCount) * sizeof(AssetPackEntry);
+  if (data.size() < indexEnd)
+    return fail("truncated index");
+
+  entries.resize(header.entryCount);
+  std::memcpy(entries.data(), data.data() + sizeof(header), entries.size() * sizeof(AssetPackEntry));
+
+  for (std::size_t i = 0; i < entries.size(); ++i) {
+    AssetPackEntry &entry = entries[i];
+    entry.path[MAX_PATH_LENGTH] = '\0';
+    if (entry.offset > data.size() || entry.size > data.size() - entry.offset)
+      return fail("entry out of bounds");
+    // image() hands the texels to the GPU upload as they are, which reads width * height pixels
+    if (entry.width == 0 || entry.height == 0 || entry.width > MAX_IMAGE_SIDE || entry.height > MAX_IMAGE_SIDE)
+      return fail("invalid image size");
+    std::uint64_t rowSize = (std::uint64_t)GetPixelDataSize((int)entry.width, 1, (int)entry.format);
+    if (rowSize == 0 || entry.size < rowSize * entry.height)
+      return fail("entry smaller than its image");
+    byPath.emplace(entry.path, i);
+  }
+
+  Logger::Info("Mounted asset pack {} ({} images, {})", file, entries.size(), data.isMapped() ? "mapped" : "read");
+  return true;
+}
+
+void AssetPack::close() {
+  data.close();
+  entries.clear();
+  byPath.clear();
+}
+
+const AssetPackEntry *AssetPack::find(std::string_view path) const {
+  auto it = byPath.find(path);
+  return it != byPath.end() ? &entries[it->second] : nullptr;
+}
+
+std::span<const unsigned char> AssetPack::texels(const AssetPackEntry &entry) const {
+  return {data.data() + entry.offset, static_cast<std::size_t>(entry.size)};
+}
+
+Image AssetPack::image(const AssetPackEntry &entry) const {
+  // LoadTextureFromImage only reads the texels
+  return {const_cast<unsigned char *>(data.data() + entry.offset), (int)entry.width, (int)entry.height, 1,
+          (int)entry.format};
+}
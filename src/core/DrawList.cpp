@@ -0,0 +1,139 @@
+#include "core/DrawList.hpp"
+#include "core/RenderBackend.hpp"
+#include <algorithm>
+#include <cmath>
+
+/**
+ * @file DrawList.cpp
+ * @brief Implementation of the recorded draw-command buffer.
+ */
+
+void DrawList::setCullArea(Rectangle area) {
+  cullArea = area;
+  culling = true;
+}
+
+void DrawList::sprite(DrawLayer layer, const Texture2D &texture, Rectangle source, Rectangle dest, Vector2 origin,
+                      float rotation, Color tint) {
+  DrawCommand cmd{layer, DrawShape::SPRITE, texture.id};
+  cmd.texture = texture;
+  cmd.source = source;
+  cmd.rect = dest;
+  cmd.origin = origin;
+  cmd.rotation = rotation;
+  cmd.color = tint;
+
+  Rectangle bounds;
+  if (rotation == 0.0f) {
+    bounds = {dest.x - origin.x, dest.y - origin.y, dest.width, dest.height};
+  } else {
+    // Rotation pivots on (dest.x, dest.y): bound by the farthest corner in any orientation
+    float rx = std::max(origin.x, dest.width - origin.x);
+    float ry = std::max(origin.y, dest.height - origin.y);
+    float r = std::sqrt(rx * rx + ry * ry);
+    bounds = {dest.x - r, dest.y - r, 2 * r, 2 * r};
+  }
+  push(cmd, bounds);
+}
+
+void DrawList::premultipliedSprite(DrawLayer layer, const Texture2D &texture, Rectangle source, Rectangle dest) {
+  DrawCommand cmd{layer, DrawShape::PREMULTIPLIED_SPRITE, texture.id};
+  cmd.texture = texture;
+  cmd.source = source;
+  cmd.rect = dest;
+  push(cmd, dest);
+}
+
+void DrawList::rect(DrawLayer layer, Rectangle rec, Color color) {
+  DrawCommand cmd{layer, DrawShape::RECT, SHAPES_KEY};
+  cmd.rect = rec;
+  cmd.color = color;
+  push(cmd, rec);
+}
+
+void DrawList::rectLines(DrawLayer layer, Rectangle rec, float thickness, Color color) {
+  DrawCommand cmd{layer, DrawShape::RECT_LINES, SHAPES_KEY};
+  cmd.rect = rec;
+  cmd.size = thickness;
+  cmd.color = color;
+  push(cmd, rec);
+}
+
+void DrawList::line(DrawLayer layer, Vector2 start, Vector2 end, float thickness, Color color) {
+  DrawCommand cmd{layer, DrawShape::LINE, SHAPES_KEY};
+  cmd.rect = {start.x, start.y, 0, 0};
+  cmd.end = end;
+  cmd.size = thickness;
+  cmd.color = color;
+
+  float half = thickness / 2.0f;
+  Rectangle bounds = {std::min(start.x, end.x) - half, std::min(start.y, end.y) - half,
+                      std::fabs(end.x - start.x) + thickness, std::fabs(end.y - start.y) + thickness};
+  push(cmd, bounds);
+}
+
+void DrawList::circle(DrawLayer layer, Vector2 center, float radius, Color color) {
+  DrawCommand cmd{layer, DrawShape::CIRCLE, SHAPES_KEY};
+  cmd.rect = {center.x, center.y, 0, 0};
+  cmd.size = radius;
+  cmd.color = color;
+  push(cmd, {center.x - radius, center.y - radius, 2 * radius, 2 * radius});
+}
+
+void DrawList::text(DrawLayer layer, std::string_view str, Vector2 position, int fontSize, Color color) {
+  DrawCommand cmd{layer, DrawShape::TEXT, TEXT_KEY};
+  cmd.rect = {position.x, position.y, 0, 0};
+  cmd.size = (float)fontSize;
+  cmd.color = color;
+
+  // Text extent is only known to the font; never culled
+  cmd.textOffset = (std::uint32_t)textPool.size();
+  textPool.append(str);
+  textPool.push_back('\0');
+  commands.push_back(cmd);
+}
+
+void DrawList::push(const DrawCommand &cmd, Rectangle bounds) {
+  if (culling && !CheckCollisionRecs(bounds, cullArea)) {
+    culledCount++;
+    return;
+  }
+  commands.push_back(cmd);
+}
+
+void DrawList::submit(RenderBackend &backend) {
+  // Back to front by layer; same-texture commands grouped where the layer allows it.
+  // Stable, so equal keys (and every command of an ordered layer) keep recording order.
+  std::stable_sort(commands.begin(), commands.end(), [](const DrawCommand &a, const DrawCommand &b) {
+    if (a.layer != b.layer)
+      return a.layer < b.layer;
+    return isSortable(a.layer) && a.key < b.key;
+  });
+
+  batches.clear();
+  for (std::size_t i = 0; i < commands.size(); ++i) {
+    const DrawCommand &cmd = commands[i];
+    if (!batches.empty() && batches.back().layer == cmd.layer && batches.back().key == cmd.key) {
+      batches.back().count++;
+    } else {
+      batches.push_back({cmd.layer, cmd.key, i, 1});
+    }
+  }
+
+  for (const DrawBatch &batch : batches) {
+    backend.drawBatch(*this, batch);
+  }
+
+  clear();
+}
+
+void DrawList::submit() {
+  static RaylibRenderBackend raylibBackend;
+  submit(raylibBackend);
+}
+
+void DrawList::clear() {
+  commands.clear();
+  textPool.clear();
+  culledCount = 0;
+}
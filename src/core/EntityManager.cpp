@@ -9,33 +9,67 @@
  */
 
 #include "core/EntityManager.hpp"
+#include "config.hpp"
 #include "core/Logger.hpp"
 #include "entities/Car.hpp"
 #include "entities/map/WorldGenerator.hpp"
+#include "entities/map/WorldSnapshot.hpp"
 #include "events/GameEvents.hpp"
+#include "raymath.h"
+#include <algorithm>
+#include <functional>
+
+namespace {
+/// Spreads the low 16 bits of v over the even bits of the result.
+std::uint32_t spreadBits(std::uint32_t v) {
+  v &= 0xFFFF;
+  v = (v | (v << 8)) & 0x00FF00FF;
+  v = (v | (v << 4)) & 0x0F0F0F0F;
+  v = (v | (v << 2)) & 0x33333333;
+  v = (v | (v << 1)) & 0x55555555;
+  return v;
+}
+
+/// Position on the Z-order curve over the world (16 bits per axis).
+std::uint32_t mortonCode(Vector2 pos, float width, float height) {
+  auto quantize = [](float v, float extent) {
+    return (std::uint32_t)std::clamp(v / extent * 65535.0f, 0.0f, 65535.0f);
+  };
+  return spreadBits(quantize(pos.x, width)) | (spreadBits(quantize(pos.y, height)) << 1);
+}
+} // namespace
 
 EntityManager::EntityManager(std::shared_ptr<EventBus> bus) : eventBus(bus) {
   // Subscribe to GenerateWorldEvent
   eventTokens.push_back(eventBus->subscribe<GenerateWorldEvent>([this](const GenerateWorldEvent &e) {
-    Logger::Info("Generating World...");
-    auto generated = WorldGenerator::generate(e.config);
-    this->setWorld(std::move(generated.world));
-
-    for (auto &mod : generated.modules) {
-      this->addModule(std::move(mod));
-    }
-
-    // Publish WorldBounds
-    if (world) {
-      eventBus->publish(WorldBoundsEvent{world->getWidth(), world->getHeight()});
-    }
+    this->setMap(WorldGenerator::create(e.config));
   }));
 
-  // Subscribe to GameUpdateEvent
-  eventTokens.push_back(eventBus->subscribe<GameUpdateEvent>([this](const GameUpdateEvent &e) { this->update(e.dt); }));
+  eventTokens.push_back(eventBus->subscribe<SaveWorldEvent>([this](const SaveWorldEvent &e) {
+    if (world)
+      WorldSnapshot::Write(e.path, *world, modules);
+  }));
 
   // Subscribe to DrawWorldEvent
-  eventTokens.push_back(eventBus->subscribe<DrawWorldEvent>([this](const DrawWorldEvent &) { this->draw(); }));
+  eventTokens.push_back(
+      eventBus->subscribe<DrawWorldEvent>([this](const DrawWorldEvent &e) {
+        if (e.drawList)
+          this->draw(e.visibleArea, e.lod, *e.drawList, e.alpha);
+      }));
+
+  // Re-bake stale static chunks around the last view before the frame's render target is bound
+  eventTokens.push_back(eventBus->subscribe<PreRenderEvent>([this](const PreRenderEvent &) {
+    staticLayer.rebake(lastView, [this](Rectangle area, DrawList &out) { this->drawStatic(area, out); });
+  }));
+
+  // A spot changing state means a parked car appeared or left there
+  eventTokens.push_back(eventBus->subscribe<SpotStateChangedEvent>([this](const SpotStateChangedEvent &e) {
+    if (!e.module)
+      return;
+    statsVersion++;
+    Spot spot = e.module->getSpot(e.spotIndex);
+    invalidateStaticAround(Vector2Add(e.module->worldPosition, spot.localPosition));
+  }));
 
   // Subscribe to CreateCarEvent
   eventTokens.push_back(eventBus->subscribe<CreateCarEvent>([this](const CreateCarEvent &e) {
@@ -80,55 +114,252 @@ EntityManager::EntityManager(std::shared_ptr<EventBus> bus) : eventBus(bus) {
 
 EntityManager::~EntityManager() { clear(); }
 
+void EntityManager::schedule(SystemScheduler &scheduler) {
+  // Re-sorting storage moves every car (and the tracked one), parking changes the baked layer
+  SystemScheduler::Access access{0, SimState::CAR_KINEMATICS | SimState::CAR_LIST | SimState::STATIC_LAYER |
+                                        SimState::TRACKING};
+  scheduler.add("physics", Config::Schedule::PHYSICS_HZ, access, [this](double dt) { update(dt); });
+}
+
 void EntityManager::update(double dt) {
   if (world) {
     world->update(dt);
   }
 
+  // Cars on the main road follow their lane leader; the others query the car grid for avoidance
+  lanes.update(cars);
+
   // Update Cars
-  // Note: Cars need access to other cars for collision avoidance/logic
-  // Currently Car::updateWithNeighbors takes a vector of unique_ptr<Car>
-  // We might need to refactor Car::updateWithNeighbors to take a raw pointer list or reference to the vector
   for (auto &car : cars) {
-    car->updateWithNeighbors(dt, &cars);
+    bool wasParked = car->getState() == Car::CarState::PARKED;
+    car->updateWithNeighbors(dt, &carGrid);
+
+    // Newly parked cars move into the baked static layer
+    if (!wasParked && car->getState() == Car::CarState::PARKED) {
+      invalidateStaticAround(car->getPosition());
+    }
+  }
+
+  // Re-bucket cars at their new positions (reordering re-buckets in curve order itself)
+  if (carReorderInterval > 0 && ++ticksSinceReorder >= carReorderInterval) {
+    reorderCars();
+  } else {
+    rebucketCars();
   }
 }
 
-void EntityManager::draw() {
+void EntityManager::rebucketCars() {
+  carGrid.clear();
+  for (const auto &car : cars) {
+    carGrid.insert(car.get(), carBounds(*car));
+  }
+}
+
+void EntityManager::reorderCars() {
+  ticksSinceReorder = 0;
+  if (!world || cars.size() < 2) {
+    rebucketCars();
+    return;
+  }
+
+  std::vector<std::pair<std::uint32_t, std::size_t>> order;
+  order.reserve(cars.size());
+  for (std::size_t i = 0; i < cars.size(); ++i) {
+    order.push_back({mortonCode(cars[i]->getPosition(), world->getWidth(), world->getHeight()), i});
+  }
+  std::sort(order.begin(), order.end());
+
+  // Back-to-back allocations in curve order: neighbours on the map end up on neighbouring cache lines
+  std::vector<std::unique_ptr<Car>> sorted;
+  std::vector<std::pair<Car *, Car *>> moves;
+  sorted.reserve(cars.size());
+  moves.reserve(cars.size());
+  for (const auto &[code, index] : order) {
+    auto moved = std::make_unique<Car>(std::move(*cars[index]));
+    moves.push_back({cars[index].get(), moved.get()});
+    sorted.push_back(std::move(moved));
+  }
+  std::sort(moves.begin(), moves.end(), [](const auto &a, const auto &b) { return std::less<>{}(a.first, b.first); });
+
+  // Everyone swaps pointers while the old cars still exist; they are freed on return
+  CarsRelocatedEvent event{moves};
+  cars.swap(sorted);
+  lanes.relocate(event);
+  rebucketCars();
+  eventBus->publish(event);
+}
+
+void EntityManager::draw(Rectangle view, RenderLod lod, DrawList &out, float alpha) {
+  lastView = view;
+
+  // Chunks not baked yet are recorded directly, so everything static (parked cars included) comes from here
+  staticLayer.draw(view, [this](Rectangle area, DrawList &list) { this->drawStatic(area, list); }, out);
+
+  if (lod == RenderLod::FAR) {
+    drawFacilityOccupancy(view, out);
+    drawCarPoints(view, alpha, out);
+  } else {
+    carGrid.query(view, [&out, alpha](Car *car) {
+      if (car->getState() != Car::CarState::PARKED)
+        car->draw(out, false, true, alpha);
+    });
+  }
+
+  // The selected car's path may reach beyond the view; the list culls its off-screen segments
+  if (dashboardVisible) {
+    for (const auto &car : cars) {
+      if (car->isSelected())
+        car->drawPath(out, lod == RenderLod::NEAR, alpha);
+    }
+  }
+
+  // Draw Mask last (Foreground)
   if (world) {
-    world->draw();
+    if (lod != RenderLod::FAR) {
+      world->drawOverlay(view, out);
+    }
+    world->drawMask(out);
   }
+}
 
-  for (const auto &mod : modules) {
-    mod->draw();
+void EntityManager::drawFacilityOccupancy(Rectangle view, DrawList &out) {
+  moduleGrid.query(view, [&out](Module *mod) {
+    if (mod->getSpotCount() == 0)
+      return;
+    Color tint = ColorLerp(GREEN, RED, mod->getOccupancyPercentage());
+    out.rect(DrawLayer::DECALS, moduleBounds(*mod), Fade(tint, 0.45f));
+  });
+}
+
+void EntityManager::drawCarPoints(Rectangle view, float alpha, DrawList &out) {
+  constexpr float size = Config::Render::LOD_CAR_POINT_SIZE;
+
+  // Plain quads share the shapes batch key, so all points merge into a single draw call
+  carGrid.query(view, [&out, alpha](Car *car) {
+    if (car->getState() == Car::CarState::PARKED)
+      return;
+
+    Color color = car->isSelected()                          ? YELLOW
+                  : car->getType() == Car::CarType::ELECTRIC ? SKYBLUE
+                                                             : ORANGE;
+    Vector2 p = car->getRenderPosition(alpha);
+    out.rect(DrawLayer::VEHICLES, {p.x - size / 2, p.y - size / 2, size, size}, color);
+  });
+}
+
+void EntityManager::drawStatic(Rectangle area, DrawList &out) {
+  if (world) {
+    world->drawBackground(area, out);
   }
 
+  moduleGrid.query(area, [&out](Module *mod) { mod->draw(out); });
+
+  carGrid.query(area, [&out](Car *car) {
+    if (car->getState() == Car::CarState::PARKED) {
+      car->draw(out, false);
+    }
+  });
+}
+
+std::uint64_t EntityManager::stateHash() const {
+  StateHash hash;
+  hash.add((std::uint64_t)cars.size());
   for (const auto &car : cars) {
-    bool showPath = car->isSelected() && this->dashboardVisible;
-    car->draw(showPath);
+    car->hashState(hash);
   }
+  return hash.value();
+}
 
-  // Draw Mask last (Foreground)
+Rectangle EntityManager::carBounds(const Car &car) {
+  // Generous enough to cover a car footprint in any orientation
+  constexpr float radius = 3.0f;
+  Vector2 pos = car.getPosition();
+  return {pos.x - radius, pos.y - radius, 2 * radius, 2 * radius};
+}
+
+void EntityManager::invalidateStaticAround(Vector2 position) {
+  // Same footprint margin as carBounds()
+  constexpr float radius = 3.0f;
+  staticLayer.invalidateArea({position.x - radius, position.y - radius, 2 * radius, 2 * radius});
+}
+
+void EntityManager::setMap(GeneratedMap map) {
+  setWorld(std::move(map.world));
+
+  // Lanes are laid out once for the whole road, not once per road module
+  for (auto &mod : map.modules) {
+    insertModule(std::move(mod));
+  }
+  lanes.build(modules);
+
+  // Publish WorldBounds
+  if (world) {
+    eventBus->publish(WorldBoundsEvent{world->getWidth(), world->getHeight()});
+  }
+}
+
+void EntityManager::setWorld(std::unique_ptr<World> w) {
+  world = std::move(w);
+  statsVersion++;
   if (world) {
-    world->drawOverlay();
-    world->drawMask();
+    Rectangle bounds = {0, 0, world->getWidth(), world->getHeight()};
+    staticLayer.reset(bounds.width, bounds.height);
+    moduleGrid.reset(bounds, Config::Render::MODULE_GRID_CELL);
+    carGrid.reset(bounds, Config::Render::CAR_GRID_CELL);
+  } else {
+    staticLayer.clear();
+    moduleGrid.reset({0, 0, 0, 0}, Config::Render::MODULE_GRID_CELL);
+    carGrid.reset({0, 0, 0, 0}, Config::Render::CAR_GRID_CELL);
+  }
+
+  // Re-bucket anything added before the world existed
+  for (const auto &mod : modules) {
+    moduleGrid.insert(mod.get(), moduleBounds(*mod));
+  }
+  for (const auto &car : cars) {
+    carGrid.insert(car.get(), carBounds(*car));
   }
 }
 
-void EntityManager::setWorld(std::unique_ptr<World> w) { world = std::move(w); }
+void EntityManager::addModule(std::unique_ptr<Module> module) {
+  bool road = module->getType() == ModuleType::ROAD;
+  insertModule(std::move(module));
+  if (road) {
+    lanes.build(modules);
+  }
+}
 
-void EntityManager::addModule(std::unique_ptr<Module> module) { modules.push_back(std::move(module)); }
+void EntityManager::insertModule(std::unique_ptr<Module> module) {
+  Rectangle bounds = moduleBounds(*module);
+  moduleGrid.insert(module.get(), bounds);
+  modules.push_back(std::move(module));
+  staticLayer.invalidateArea(bounds);
+  statsVersion++;
+}
 
-void EntityManager::addCar(std::unique_ptr<Car> car) { cars.push_back(std::move(car)); }
+void EntityManager::addCar(std::unique_ptr<Car> car) {
+  carGrid.insert(car.get(), carBounds(*car));
+  cars.push_back(std::move(car));
+}
 
 void EntityManager::clear() {
+  carGrid.clear();
+  moduleGrid.clear();
+  lanes.clear();
   cars.clear();
   modules.clear();
   world.reset();
+  staticLayer.clear();
+  statsVersion++;
 }
 
 void EntityManager::removeCar(Car *car) {
   if (!car)
     return;
+  if (car->getState() == Car::CarState::PARKED) {
+    invalidateStaticAround(car->getPosition());
+  }
+  carGrid.remove(car, carBounds(*car));
+  lanes.remove(car);
   std::erase_if(cars, [car](const std::unique_ptr<Car> &ptr) { return ptr.get() == car; });
 }
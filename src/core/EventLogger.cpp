@@ -60,6 +60,10 @@ EventLogger::EventLogger(std::shared_ptr<EventBus> bus) : eventBus(bus) {
     Logger::Info("Event: AutoSpawnLevelChangedEvent [Level: {}]", e.newLevel);
   }));
 
+  subscriptions.push_back(eventBus->subscribe<FlowModelChangedEvent>([](const FlowModelChangedEvent &e) {
+    Logger::Info("Event: FlowModelChangedEvent [Mesoscopic: {}]", e.mesoscopic);
+  }));
+
   subscriptions.push_back(eventBus->subscribe<SpawnCarRequestEvent>(
       [](const SpawnCarRequestEvent &) { Logger::Info("Event: SpawnCarRequestEvent"); }));
 
@@ -70,7 +74,7 @@ EventLogger::EventLogger(std::shared_ptr<EventBus> bus) : eventBus(bus) {
       eventBus->subscribe<CarSpawnedEvent>([](const CarSpawnedEvent &) { Logger::Info("Event: CarSpawnedEvent"); }));
 
   subscriptions.push_back(eventBus->subscribe<AssignPathEvent>(
-      [](const AssignPathEvent &e) { Logger::Info("Event: AssignPathEvent [PathSize: {}]", e.path.size()); }));
+      [](const AssignPathEvent &e) { Logger::Info("Event: AssignPathEvent [PathSize: {}]", e.path ? e.path->size() : 0); }));
 
   subscriptions.push_back(eventBus->subscribe<CarFinishedParkingEvent>(
       [](const CarFinishedParkingEvent &) { Logger::Info("Event: CarFinishedParkingEvent"); }));
@@ -78,6 +82,10 @@ EventLogger::EventLogger(std::shared_ptr<EventBus> bus) : eventBus(bus) {
   subscriptions.push_back(
       eventBus->subscribe<CarDespawnEvent>([](const CarDespawnEvent &) { Logger::Info("Event: CarDespawnEvent"); }));
 
+  subscriptions.push_back(eventBus->subscribe<CarsRelocatedEvent>([](const CarsRelocatedEvent &e) {
+    Logger::Info("Event: CarsRelocatedEvent [Cars: {}]", e.moves.size());
+  }));
+
   subscriptions.push_back(eventBus->subscribe<SimulationSpeedChangedEvent>([](const SimulationSpeedChangedEvent &e) {
     Logger::Info("Event: SimulationSpeedChangedEvent [Mul: {}]", e.speedMultiplier);
   }));
@@ -1,6 +1,7 @@
 #include "core/GameLoop.hpp"
 #include "config.hpp"
 #include "raylib.h"
+#include <utility>
 
 /**
  * @file GameLoop.cpp
@@ -13,9 +14,11 @@
  * Implementation of the "Fix Your Timestep" pattern.
  * - Accumulates elapsed time in a buffer.
  * - Consumes time in fixed slices (dt) for logic updates (Physics, AI).
- * - Renders once per frame using the remaining state.
+ * - Renders once per frame, passing the leftover fraction of a tick so the renderer can
+ *   blend between the previous and the current state (tick rate independent of frame rate).
  */
-void GameLoop::run(std::function<void(double)> update, std::function<void()> render, std::function<bool()> running) {
+void GameLoop::run(std::function<void(double)> update, std::function<void(double)> render,
+                   std::function<bool()> running) {
 
   const double dt = Config::FIXED_DELTA_TIME;
   double currentTime = GetTime();
@@ -40,6 +43,10 @@ void GameLoop::run(std::function<void(double)> update, std::function<void()> ren
       update(dt);
       accumulator -= dt;
     }
-    render();
+    render(accumulator / dt);
   }
 }
+
+void GameLoop::run(std::function<void(double)> update, std::function<void()> render, std::function<bool()> running) {
+  run(std::move(update), [&render](double) { render(); }, std::move(running));
+}
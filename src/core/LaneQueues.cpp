@@ -0,0 +1,138 @@
+#include "core/LaneQueues.hpp"
+#include "config.hpp"
+#include <algorithm>
+#include <cmath>
+
+/**
+ * @file LaneQueues.cpp
+ * @brief Implementation of the main road lane queues.
+ */
+
+namespace {
+// Cars spawn at the road's end and leave a little beyond it
+constexpr float EDGE_MARGIN = 3.0f;
+} // namespace
+
+void LaneQueues::build(const std::vector<std::unique_ptr<Module>> &modules) {
+  clear();
+
+  const float pixelsPerMeter = static_cast<float>(Config::ART_PIXELS_PER_METER);
+  std::vector<float> rowTops; // Roads of one row share their top edge; row r owns lanes 2r (UP) and 2r+1 (DOWN)
+  for (const auto &mod : modules) {
+    if (mod->getType() != ModuleType::ROAD)
+      continue;
+
+    float top = mod->worldPosition.y;
+    float minX = mod->worldPosition.x;
+    float maxX = mod->worldPosition.x + mod->getWidth();
+    auto row = std::find_if(rowTops.begin(), rowTops.end(), [top](float y) { return std::fabs(y - top) < 0.01f; });
+    if (row != rowTops.end()) {
+      std::size_t first = 2 * (row - rowTops.begin());
+      for (std::size_t i = first; i < first + 2; ++i) {
+        lanes[i].minX = std::min(lanes[i].minX, minX);
+        lanes[i].maxX = std::max(lanes[i].maxX, maxX);
+      }
+      continue;
+    }
+
+    rowTops.push_back(top);
+    lanes.push_back({top + Config::LANE_OFFSET_UP / pixelsPerMeter, -1.0f, minX, maxX, {}});
+    lanes.push_back({top + Config::LANE_OFFSET_DOWN / pixelsPerMeter, 1.0f, minX, maxX, {}});
+  }
+}
+
+void LaneQueues::clear() {
+  // Queued cars must rejoin from scratch on the next update
+  for (const LaneQueue &lane : lanes)
+    for (Car *car : lane.cars)
+      car->setLane(-1, 0.0f, nullptr);
+  lanes.clear();
+}
+
+int LaneQueues::laneFor(const Car &car) const {
+  if (car.getState() != Car::CarState::DRIVING && car.getState() != Car::CarState::EXITING)
+    return -1;
+
+  Vector2 pos = car.getPosition();
+  Vector2 vel = car.getVelocity();
+  for (int i = 0; i < (int)lanes.size(); ++i) {
+    const LaneQueue &lane = lanes[i];
+    if (std::fabs(pos.y - lane.y) > Config::CarAI::Lanes::HALF_WIDTH)
+      continue;
+    if (pos.x < lane.minX - EDGE_MARGIN || pos.x > lane.maxX + EDGE_MARGIN)
+      continue;
+    // Heading along the lane (mostly longitudinal); standing cars keep their lane
+    if (vel.x * lane.direction < 0.0f || std::fabs(vel.y) > std::fabs(vel.x) + 0.1f)
+      continue;
+    return i;
+  }
+  return -1;
+}
+
+void LaneQueues::update(const std::vector<std::unique_ptr<Car>> &cars) {
+  // Joining cars are appended, cars that left are dropped; everyone else keeps their place
+  for (const auto &car : cars) {
+    int lane = laneFor(*car);
+    if (lane != car->getLane()) {
+      if (lane >= 0)
+        lanes[lane].cars.push_back(car.get());
+      car->setLane(lane, lane >= 0 ? lanes[lane].direction : 0.0f, nullptr);
+    }
+  }
+
+  for (int i = 0; i < (int)lanes.size(); ++i) {
+    auto &queue = lanes[i].cars;
+    std::erase_if(queue, [i](const Car *car) { return car->getLane() != i; });
+
+    // Insertion sort: linear when (as usual) only a few cars are out of order
+    for (std::size_t j = 1; j < queue.size(); ++j) {
+      Car *car = queue[j];
+      float x = car->getPosition().x;
+      std::size_t k = j;
+      for (; k > 0 && queue[k - 1]->getPosition().x > x; --k)
+        queue[k] = queue[k - 1];
+      queue[k] = car;
+    }
+
+    assignLeaders(i);
+  }
+}
+
+void LaneQueues::remove(Car *car) {
+  int lane = car->getLane();
+  if (lane < 0 || lane >= (int)lanes.size())
+    return;
+  std::erase(lanes[lane].cars, car);
+  car->setLane(-1, 0.0f, nullptr);
+  assignLeaders(lane);
+}
+
+void LaneQueues::relocate(const CarsRelocatedEvent &event) {
+  for (int i = 0; i < (int)lanes.size(); ++i) {
+    for (Car *&car : lanes[i].cars)
+      car = event.relocated(car);
+    assignLeaders(i);
+  }
+}
+
+void LaneQueues::assignLeaders(int lane) {
+  const LaneQueue &queue = lanes[lane];
+  const std::size_t count = queue.cars.size();
+  auto gap = [&queue](std::size_t a, std::size_t b) {
+    return queue.cars[b]->getPosition().x - queue.cars[a]->getPosition().x - Config::CarAI::CAR_LENGTH;
+  };
+
+  for (std::size_t j = 0; j < count; ++j) {
+    // Ahead means larger X on a +X lane, smaller X on a -X lane
+    const Car *leader = nullptr;
+    if (queue.direction > 0 && j + 1 < count)
+      leader = queue.cars[j + 1];
+    else if (queue.direction < 0 && j > 0)
+      leader = queue.cars[j - 1];
+
+    // Isolated: room on both sides (the neighbours' distance matters to them too)
+    bool isolated = (j == 0 || gap(j - 1, j) > Config::CarAI::SimLod::ISOLATION_GAP) &&
+                    (j + 1 == count || gap(j, j + 1) > Config::CarAI::SimLod::ISOLATION_GAP);
+    queue.cars[j]->setLane(lane, queue.direction, leader, isolated);
+  }
+}
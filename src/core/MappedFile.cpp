@@ -0,0 +1,105 @@
+#include "core/MappedFile.hpp"
+#include <fstream>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @file MappedFile.cpp
+ * @brief Implementation of the read-only file mapping (POSIX mmap / Win32 file mapping).
+ */
+
+MappedFile::~MappedFile() { close(); }
+
+bool MappedFile::open(const std::string &path) {
+  close();
+
+#ifdef _WIN32
+  HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                            FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE)
+    return false;
+
+  LARGE_INTEGER fileSize;
+  if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0) {
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping) {
+      void *address = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+      if (address) {
+        fileHandle = file;
+        mappingHandle = mapping;
+        view = static_cast<const unsigned char *>(address);
+        length = static_cast<std::size_t>(fileSize.QuadPart);
+        mapped = true;
+        return true;
+      }
+      CloseHandle(mapping);
+    }
+  }
+  CloseHandle(file);
+#else
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0)
+    return false;
+
+  struct stat info;
+  if (fstat(fd, &info) == 0 && info.st_size > 0) {
+    void *address = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    if (address != MAP_FAILED) {
+      // The mapping keeps its own reference to the file
+      ::close(fd);
+      view = static_cast<const unsigned char *>(address);
+      length = static_cast<std::size_t>(info.st_size);
+      mapped = true;
+      return true;
+    }
+  }
+  ::close(fd);
+#endif
+
+  // Fallback: plain read
+  std::ifstream in(path, std::ios::binary | std::ios::ate);
+  if (!in)
+    return false;
+  std::streamsize fileSize = in.tellg();
+  if (fileSize <= 0)
+    return false;
+
+  fallback.resize(static_cast<std::size_t>(fileSize));
+  in.seekg(0);
+  if (!in.read(reinterpret_cast<char *>(fallback.data()), fileSize)) {
+    fallback.clear();
+    return false;
+  }
+  view = fallback.data();
+  length = fallback.size();
+  return true;
+}
+
+void MappedFile::close() {
+  if (mapped) {
+#ifdef _WIN32
+    UnmapViewOfFile(view);
+    CloseHandle(static_cast<HANDLE>(mappingHandle));
+    CloseHandle(static_cast<HANDLE>(fileHandle));
+    mappingHandle = nullptr;
+    fileHandle = nullptr;
+#else
+    munmap(const_cast<unsigned char *>(view), length);
+#endif
+  }
+
+  fallback.clear();
+  fallback.shrink_to_fit();
+  view = nullptr;
+  length = 0;
+  mapped = false;
+}
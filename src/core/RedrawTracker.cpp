@@ -0,0 +1,53 @@
+#include "core/RedrawTracker.hpp"
+#include "config.hpp"
+#include "events/GameEvents.hpp"
+#include "events/InputEvents.hpp"
+#include "events/TrackingEvents.hpp"
+#include "events/WindowEvents.hpp"
+
+/**
+ * @file RedrawTracker.cpp
+ * @brief Implementation of the on-demand rendering tracker.
+ */
+
+RedrawTracker::RedrawTracker(std::shared_ptr<EventBus> bus)
+    : eventBus(bus), pendingFrames(Config::Render::REDRAW_SETTLE_FRAMES) {
+
+  // Input
+  eventTokens.push_back(bus->subscribe<KeyPressedEvent>([this](const KeyPressedEvent &) { requestRedraw(); }));
+  eventTokens.push_back(bus->subscribe<KeyReleasedEvent>([this](const KeyReleasedEvent &) { requestRedraw(); }));
+  eventTokens.push_back(bus->subscribe<MouseClickEvent>([this](const MouseClickEvent &) { requestRedraw(); }));
+  eventTokens.push_back(bus->subscribe<MouseWheelEvent>([this](const MouseWheelEvent &) { requestRedraw(); }));
+  eventTokens.push_back(bus->subscribe<MouseMovedEvent>([this](const MouseMovedEvent &e) {
+    if (e.position.x != lastMousePos.x || e.position.y != lastMousePos.y) {
+      lastMousePos = e.position;
+      requestRedraw();
+    }
+  }));
+
+  // Camera
+  eventTokens.push_back(bus->subscribe<CameraZoomEvent>([this](const CameraZoomEvent &) { requestRedraw(); }));
+  eventTokens.push_back(bus->subscribe<CameraMoveEvent>([this](const CameraMoveEvent &) { requestRedraw(); }));
+  eventTokens.push_back(
+      bus->subscribe<TrackingStatusEvent>([this](const TrackingStatusEvent &) { requestRedraw(); }));
+
+  // Simulation step (not published while paused)
+  eventTokens.push_back(bus->subscribe<GameUpdateEvent>([this](const GameUpdateEvent &) { requestRedraw(); }));
+
+  // Scene and window
+  eventTokens.push_back(bus->subscribe<SceneLoadedEvent>([this](const SceneLoadedEvent &) { requestRedraw(); }));
+  eventTokens.push_back(
+      bus->subscribe<WorldLoadProgressEvent>([this](const WorldLoadProgressEvent &) { requestRedraw(); }));
+  eventTokens.push_back(bus->subscribe<WindowResizeEvent>([this](const WindowResizeEvent &) { requestRedraw(); }));
+}
+
+void RedrawTracker::requestRedraw() { pendingFrames = Config::Render::REDRAW_SETTLE_FRAMES; }
+
+bool RedrawTracker::shouldRender() {
+  if (!Config::Render::ON_DEMAND_RENDERING)
+    return true;
+  if (pendingFrames == 0)
+    return false;
+  pendingFrames--;
+  return true;
+}
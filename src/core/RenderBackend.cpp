@@ -0,0 +1,60 @@
+#include "core/RenderBackend.hpp"
+
+/**
+ * @file RenderBackend.cpp
+ * @brief Implementation of the raylib and counting render backends.
+ */
+
+void RaylibRenderBackend::drawBatch(const DrawList &list, const DrawBatch &batch) {
+  const auto &commands = list.getCommands();
+
+  for (std::size_t i = batch.first; i < batch.first + batch.count; ++i) {
+    const DrawCommand &cmd = commands[i];
+
+    switch (cmd.shape) {
+    case DrawShape::SPRITE:
+      DrawTexturePro(cmd.texture, cmd.source, cmd.rect, cmd.origin, cmd.rotation, cmd.color);
+      break;
+    case DrawShape::PREMULTIPLIED_SPRITE:
+      BeginBlendMode(BLEND_ALPHA_PREMULTIPLY);
+      DrawTexturePro(cmd.texture, cmd.source, cmd.rect, cmd.origin, cmd.rotation, cmd.color);
+      EndBlendMode();
+      break;
+    case DrawShape::RECT:
+      DrawRectangleRec(cmd.rect, cmd.color);
+      break;
+    case DrawShape::RECT_LINES:
+      DrawRectangleLinesEx(cmd.rect, cmd.size, cmd.color);
+      break;
+    case DrawShape::LINE:
+      if (cmd.size > 0.0f)
+        DrawLineEx({cmd.rect.x, cmd.rect.y}, cmd.end, cmd.size, cmd.color);
+      else
+        DrawLineV({cmd.rect.x, cmd.rect.y}, cmd.end, cmd.color);
+      break;
+    case DrawShape::CIRCLE:
+      DrawCircleV({cmd.rect.x, cmd.rect.y}, cmd.size, cmd.color);
+      break;
+    case DrawShape::TEXT:
+      DrawText(list.getText(cmd), (int)cmd.rect.x, (int)cmd.rect.y, (int)cmd.size, cmd.color);
+      break;
+    }
+  }
+}
+
+void CountingRenderBackend::drawBatch(const DrawList & /*list*/, const DrawBatch &batch) {
+  std::size_t layer = static_cast<std::size_t>(batch.layer);
+
+  batches++;
+  commands += batch.count;
+  layerBatches[layer]++;
+  layerCommands[layer] += batch.count;
+  log.push_back(batch);
+}
+
+void CountingRenderBackend::reset() {
+  batches = commands = 0;
+  layerBatches.fill(0);
+  layerCommands.fill(0);
+  log.clear();
+}
@@ -0,0 +1,164 @@
+#include "core/StaticLayerCache.hpp"
+#include "config.hpp"
+#include "core/Logger.hpp"
+#include <algorithm>
+#include <cmath>
+
+/**
+ * @file StaticLayerCache.cpp
+ * @brief Implementation of the baked static render layer.
+ */
+
+static constexpr float CHUNK_METERS = Config::Render::STATIC_CHUNK_SIZE / Config::Render::STATIC_LAYER_PPM;
+
+StaticLayerCache::~StaticLayerCache() { clear(); }
+
+void StaticLayerCache::reset(float width, float height) {
+  clear();
+
+  columns = std::max(1, (int)std::ceil(width / CHUNK_METERS));
+  rows = std::max(1, (int)std::ceil(height / CHUNK_METERS));
+
+  for (int cy = 0; cy < rows; ++cy) {
+    for (int cx = 0; cx < columns; ++cx) {
+      float x = cx * CHUNK_METERS;
+      float y = cy * CHUNK_METERS;
+      // Edge chunks only cover what is left of the world
+      chunks.push_back({{x, y, std::min(CHUNK_METERS, width - x), std::min(CHUNK_METERS, height - y)}});
+    }
+  }
+
+  Logger::Info("Static layer: {}x{} chunks for {}x{}m world.", columns, rows, width, height);
+}
+
+void StaticLayerCache::clear() {
+  for (auto &chunk : chunks) {
+    if (chunk.target.id != 0) {
+      UnloadRenderTexture(chunk.target);
+    }
+  }
+  chunks.clear();
+  columns = rows = residentCount = 0;
+}
+
+void StaticLayerCache::invalidateAll() {
+  for (auto &chunk : chunks) {
+    chunk.dirty = true;
+  }
+}
+
+void StaticLayerCache::invalidateArea(Rectangle area) {
+  int minX, maxX, minY, maxY;
+  if (!chunkRange(area, minX, maxX, minY, maxY))
+    return;
+
+  for (int cy = minY; cy <= maxY; ++cy) {
+    for (int cx = minX; cx <= maxX; ++cx) {
+      chunks[cy * columns + cx].dirty = true;
+    }
+  }
+}
+
+void StaticLayerCache::rebake(Rectangle view, const DrawAreaFn &drawArea) {
+  // Half a chunk of margin so slow panning finds its neighbours already baked
+  constexpr float margin = CHUNK_METERS * 0.5f;
+  Rectangle area = {view.x - margin, view.y - margin, view.width + 2 * margin, view.height + 2 * margin};
+
+  int minX, maxX, minY, maxY;
+  if (!chunkRange(area, minX, maxX, minY, maxY))
+    return;
+
+  for (int cy = minY; cy <= maxY; ++cy) {
+    for (int cx = minX; cx <= maxX; ++cx) {
+      Chunk &chunk = chunks[cy * columns + cx];
+      if (!chunk.dirty)
+        continue;
+
+      if (chunk.target.id == 0) {
+        int w = (int)std::ceil(chunk.bounds.width * Config::Render::STATIC_LAYER_PPM);
+        int h = (int)std::ceil(chunk.bounds.height * Config::Render::STATIC_LAYER_PPM);
+        chunk.target = LoadRenderTexture(w, h);
+        residentCount++;
+      }
+
+      // Camera mapping the chunk's top-left corner to texel (0, 0)
+      Camera2D bakeCamera = {{0, 0}, {chunk.bounds.x, chunk.bounds.y}, 0.0f, Config::Render::STATIC_LAYER_PPM};
+
+      BeginTextureMode(chunk.target);
+      ClearBackground(BLANK);
+      BeginMode2D(bakeCamera);
+      drawArea(chunk.bounds, bakeList);
+      bakeList.submit();
+      EndMode2D();
+      EndTextureMode();
+
+      chunk.dirty = false;
+    }
+  }
+
+  if (residentCount > Config::Render::MAX_RESIDENT_CHUNKS) {
+    evict(area);
+  }
+}
+
+void StaticLayerCache::draw(Rectangle view, const DrawAreaFn &drawFallback, DrawList &out) {
+  frame++;
+
+  int minX, maxX, minY, maxY;
+  if (!chunkRange(view, minX, maxX, minY, maxY))
+    return;
+
+  for (int cy = minY; cy <= maxY; ++cy) {
+    for (int cx = minX; cx <= maxX; ++cx) {
+      Chunk &chunk = chunks[cy * columns + cx];
+
+      // Not baked yet (first frame, or scrolled in since the last PreRenderEvent)
+      if (chunk.dirty || chunk.target.id == 0) {
+        drawFallback(GetCollisionRec(chunk.bounds, view), out);
+        continue;
+      }
+
+      const Texture2D &tex = chunk.target.texture;
+
+      // Render textures are stored upside down: flip the source rectangle
+      Rectangle source = {0, 0, (float)tex.width, -(float)tex.height};
+      Rectangle dest = {chunk.bounds.x, chunk.bounds.y, tex.width / Config::Render::STATIC_LAYER_PPM,
+                        tex.height / Config::Render::STATIC_LAYER_PPM};
+      out.sprite(DrawLayer::BACKGROUND, tex, source, dest, {0, 0}, 0.0f, WHITE);
+      chunk.lastDrawn = frame;
+    }
+  }
+}
+
+bool StaticLayerCache::chunkRange(Rectangle area, int &minX, int &maxX, int &minY, int &maxY) const {
+  if (chunks.empty() || area.x > columns * CHUNK_METERS || area.y > rows * CHUNK_METERS ||
+      area.x + area.width < 0 || area.y + area.height < 0)
+    return false;
+
+  minX = std::clamp((int)std::floor(area.x / CHUNK_METERS), 0, columns - 1);
+  maxX = std::clamp((int)std::floor((area.x + area.width) / CHUNK_METERS), 0, columns - 1);
+  minY = std::clamp((int)std::floor(area.y / CHUNK_METERS), 0, rows - 1);
+  maxY = std::clamp((int)std::floor((area.y + area.height) / CHUNK_METERS), 0, rows - 1);
+  return true;
+}
+
+void StaticLayerCache::evict(Rectangle view) {
+  std::vector<Chunk *> candidates;
+  for (auto &chunk : chunks) {
+    if (chunk.target.id != 0 && !CheckCollisionRecs(chunk.bounds, view)) {
+      candidates.push_back(&chunk);
+    }
+  }
+
+  std::sort(candidates.begin(), candidates.end(),
+            [](const Chunk *a, const Chunk *b) { return a->lastDrawn < b->lastDrawn; });
+
+  for (Chunk *chunk : candidates) {
+    if (residentCount <= Config::Render::MAX_RESIDENT_CHUNKS)
+      break;
+    UnloadRenderTexture(chunk->target);
+    chunk->target = {};
+    chunk->dirty = true;
+    residentCount--;
+  }
+}
@@ -0,0 +1,198 @@
+#include "core/SystemScheduler.hpp"
+#include "core/Logger.hpp"
+#include "core/ThreadPool.hpp"
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <format>
+#include <future>
+#include <limits>
+#include <numeric>
+
+/**
+ * @file SystemScheduler.cpp
+ * @brief Implementation of the multi-rate, staged system scheduler.
+ */
+
+namespace {
+/// Flag names joined with '+' (for the graph dump).
+std::string FlagList(std::uint32_t flags) {
+  if (flags == SimState::ALL)
+    return "all";
+  std::string out;
+  while (flags) {
+    std::uint32_t flag = flags & (~flags + 1);
+    flags &= ~flag;
+    if (!out.empty())
+      out += '+';
+    out += SimState::Name(flag);
+  }
+  return out;
+}
+} // namespace
+
+const char *SimState::Name(std::uint32_t flag) {
+  switch (flag) {
+  case CAR_KINEMATICS:
+    return "car kinematics";
+  case CAR_LIST:
+    return "car list";
+  case SPOT_STATE:
+    return "spot state";
+  case ROAD_FLOW:
+    return "road flow";
+  case STATIC_LAYER:
+    return "static layer";
+  case TRACKING:
+    return "tracking";
+  case CAMERA:
+    return "camera";
+  default:
+    return "?";
+  }
+}
+
+SystemScheduler::SystemScheduler(double tickDt) : tickDt(tickDt) {}
+
+void SystemScheduler::add(std::string name, double rateHz, Access access, Task task) {
+  int period = 1;
+  if (rateHz > 0.0 && rateHz * tickDt < 1.0) {
+    period = std::max(1, (int)std::lround(1.0 / (rateHz * tickDt)));
+  }
+  int phase = pickPhase(period);
+  // Counted from the next tick, so a system added mid-run keeps its phase
+  phase = (int)((phase + tickCount) % (std::uint64_t)period);
+
+  // Follows every earlier system it conflicts with, one stage past the latest of them
+  System system{std::move(name), rateHz, period, phase, access, 0, {}, 0.0, std::move(task)};
+  for (std::size_t i = 0; i < systems.size(); ++i) {
+    if (Conflicts(systems[i].access, access)) {
+      system.after.push_back(i);
+      system.stage = std::max(system.stage, systems[i].stage + 1);
+    }
+  }
+
+  if ((std::size_t)system.stage >= stages.size())
+    stages.resize(system.stage + 1);
+  stages[system.stage].push_back(systems.size());
+
+  Logger::Info("SystemScheduler: {} at {} Hz (every {} ticks, phase {}), stage {}", system.name, rateHz, period, phase,
+               system.stage);
+  systems.push_back(std::move(system));
+}
+
+std::uint32_t SystemScheduler::Conflicts(const Access &a, const Access &b) {
+  return (a.writes & (b.reads | b.writes)) | (b.writes & a.reads);
+}
+
+int SystemScheduler::pickPhase(int period) const {
+  if (period == 1)
+    return 0;
+
+  // Two systems meet on a tick iff their phases agree modulo the gcd of their periods; every-tick
+  // systems meet everyone and do not take part
+  int bestPhase = 0;
+  int bestCollisions = std::numeric_limits<int>::max();
+  for (int phase = 0; phase < period; ++phase) {
+    int collisions = 0;
+    for (const auto &system : systems) {
+      if (system.period == 1)
+        continue;
+      int shared = std::gcd(period, system.period);
+      int existing = (int)((system.phase + (std::uint64_t)system.period - tickCount % system.period) % system.period);
+      if (phase % shared == existing % shared)
+        collisions++;
+    }
+    if (collisions < bestCollisions) {
+      bestCollisions = collisions;
+      bestPhase = phase;
+    }
+  }
+  return bestPhase;
+}
+
+void SystemScheduler::tick(double dt) {
+  for (auto &system : systems) {
+    system.pendingDt += dt;
+  }
+
+  std::vector<System *> due;
+  for (const auto &stage : stages) {
+    due.clear();
+    for (std::size_t index : stage) {
+      System &system = systems[index];
+      if (tickCount % (std::uint64_t)system.period == (std::uint64_t)system.phase)
+        due.push_back(&system);
+    }
+    runStage(due);
+  }
+  tickCount++;
+}
+
+void SystemScheduler::runStage(const std::vector<System *> &due) {
+  auto run = [](System *system) {
+    double elapsed = system->pendingDt;
+    system->pendingDt = 0.0;
+    system->task(elapsed);
+  };
+
+  if (due.empty())
+    return;
+  if (!workers || due.size() == 1) {
+    for (System *system : due)
+      run(system);
+    return;
+  }
+
+  // The rest go to the workers while this thread runs the first; the stage ends when all are back
+  std::vector<std::future<void>> pending;
+  pending.reserve(due.size() - 1);
+  for (std::size_t i = 1; i < due.size(); ++i) {
+    pending.push_back(workers->submit([&run, system = due[i]]() { run(system); }));
+  }
+
+  std::exception_ptr failure;
+  try {
+    run(due.front());
+  } catch (...) {
+    failure = std::current_exception();
+  }
+  for (auto &job : pending) {
+    try {
+      job.get();
+    } catch (...) {
+      if (!failure)
+        failure = std::current_exception();
+    }
+  }
+  if (failure)
+    std::rethrow_exception(failure);
+}
+
+void SystemScheduler::clear() {
+  systems.clear();
+  stages.clear();
+  tickCount = 0;
+}
+
+std::string SystemScheduler::toDot() const {
+  std::string dot = "digraph systems {\n  rankdir=LR;\n  node [shape=box];\n";
+  for (std::size_t s = 0; s < stages.size(); ++s) {
+    dot += std::format("  subgraph cluster_stage{} {{\n    label=\"stage {}\";\n", s, s);
+    for (std::size_t index : stages[s]) {
+      const System &system = systems[index];
+      dot += std::format("    s{} [label=\"{}\\n{} Hz\\nreads: {}\\nwrites: {}\"];\n", index, system.name, system.rateHz,
+                         system.access.reads ? FlagList(system.access.reads) : "-",
+                         system.access.writes ? FlagList(system.access.writes) : "-");
+    }
+    dot += "  }\n";
+  }
+  for (std::size_t i = 0; i < systems.size(); ++i) {
+    for (std::size_t before : systems[i].after) {
+      dot += std::format("  s{} -> s{} [label=\"{}\"];\n", before, i,
+                         FlagList(Conflicts(systems[before].access, systems[i].access)));
+    }
+  }
+  dot += "}\n";
+  return dot;
+}
@@ -0,0 +1,56 @@
+#include "core/ThreadPool.hpp"
+#include <algorithm>
+
+/**
+ * @file ThreadPool.cpp
+ * @brief Implementation of the worker thread pool.
+ */
+
+ThreadPool::ThreadPool(std::size_t threadCount) {
+  if (threadCount == 0) {
+    threadCount = std::max(1u, std::thread::hardware_concurrency());
+  }
+
+  workers.reserve(threadCount);
+  for (std::size_t i = 0; i < threadCount; ++i) {
+    workers.emplace_back([this]() { workerLoop(); });
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard lock(mutex);
+    stopping = true;
+  }
+  available.notify_all();
+
+  for (auto &worker : workers) {
+    worker.join();
+  }
+}
+
+void ThreadPool::enqueue(std::function<void()> job) {
+  {
+    std::lock_guard lock(mutex);
+    jobs.push(std::move(job));
+  }
+  available.notify_one();
+}
+
+void ThreadPool::workerLoop() {
+  while (true) {
+    std::function<void()> job;
+    {
+      std::unique_lock lock(mutex);
+      available.wait(lock, [this]() { return stopping || !jobs.empty(); });
+
+      // Drain the queue before exiting so no future is left without a value
+      if (jobs.empty())
+        return;
+
+      job = std::move(jobs.front());
+      jobs.pop();
+    }
+    job();
+  }
+}
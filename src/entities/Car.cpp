@@ -6,6 +6,9 @@
 
 #include "config.hpp"
 #include "core/AssetManager.hpp"
+#include "core/DetMath.hpp"
+#include <algorithm>
+#include <cmath>
 
 /**
  * @file Car.cpp
@@ -15,6 +18,27 @@
  * via waypoints, and state transitions (Driving, Parking, Charging).
  */
 
+namespace {
+// The per-tick damping and smoothing factors below were tuned at 60 Hz
+constexpr double TUNED_TICK_RATE = 60.0;
+
+/// Rescales a per-tick multiplier (e.g. velocity *= 0.95) so it decays at the same rate for any dt.
+float decayFactor(float perTick, double dt) { return DetMath::Pow(perTick, (float)(dt * TUNED_TICK_RATE)); }
+
+/// Rescales a per-tick lerp fraction (e.g. x += diff * 0.12) so it converges at the same rate for any dt.
+float lerpFactor(float perTick, double dt) { return 1.0f - decayFactor(1.0f - perTick, dt); }
+
+/// Shortest signed difference between two angles in degrees, in [-180, 180].
+float angleDelta(float from, float to) {
+  float diff = to - from;
+  while (diff > 180.0f)
+    diff -= 360.0f;
+  while (diff < -180.0f)
+    diff += 360.0f;
+  return diff;
+}
+} // namespace
+
 /**
  * @brief Constructs a new Car object.
  *
@@ -24,22 +48,47 @@
  * @param type The propulsion type (Combustion or Electric).
  */
 Car::Car(Vector2 startPos, const World * /*world*/, Vector2 initialVelocity, CarType type)
-    : position(startPos), velocity(initialVelocity), acceleration{0, 0}, maxSpeed(15.0f), maxForce(60.0f), type(type) {
+    : position(startPos), velocity(initialVelocity), acceleration{0, 0}, previousPosition(startPos), maxSpeed(15.0f),
+      maxForce(60.0f), type(type) {
 
   // Select a random visual variant (1-3) based on vehicle type
   int variant = GetRandomValue(1, 3);
   if (type == CarType::COMBUSTION) {
-    textureName = "car1" + std::to_string(variant);
+    texture = AssetManager::Get().GetTextureHandle("car1" + std::to_string(variant));
     batteryLevel = 0.0f;
   } else {
-    textureName = "car2" + std::to_string(variant);
+    texture = AssetManager::Get().GetTextureHandle("car2" + std::to_string(variant));
     batteryLevel = (float)GetRandomValue(10, 90); // Initialize with random charge
   }
 
   // Set initial heading based on starting velocity
   if (Vector2Length(velocity) > 0.1f) {
-    currentRotation = atan2f(velocity.y, velocity.x) * RAD2DEG + 90.0f;
+    currentRotation = DetMath::Atan2(velocity.y, velocity.x) * RAD2DEG + 90.0f;
   }
+  previousRotation = currentRotation;
+}
+
+Vector2 Car::getRenderPosition(float alpha) const { return Vector2Lerp(previousPosition, position, alpha); }
+
+float Car::getRenderRotation(float alpha) const {
+  return previousRotation + angleDelta(previousRotation, currentRotation) * alpha;
+}
+
+OrientedBox Car::getFootprint() const {
+  // The sprite points up (-Y) at rotation 0
+  float angle = (currentRotation - 90.0f) * DEG2RAD;
+  return {position, {DetMath::Cos(angle), DetMath::Sin(angle)}, Config::CarAI::CAR_LENGTH * 0.5f,
+          Config::CarAI::CAR_WIDTH * 0.5f};
+}
+
+void Car::hashState(StateHash &hash) const {
+  hash.add(position);
+  hash.add(velocity);
+  hash.add(currentRotation);
+  hash.add((std::uint64_t)state);
+  hash.add((std::uint64_t)getRemainingWaypoints());
+  hash.add(batteryLevel);
+  hash.add(parkingTimer);
 }
 
 /**
@@ -75,39 +124,38 @@ void Car::update(double dt) { updateWithNeighbors(dt, nullptr); }
  * Logic flow:
  * 1. State Management (Handle static states like PARKED).
  * 2. Path Following (Calculate steering toward current waypoint).
- * 3. Collision Avoidance (Apply braking/repulsion based on nearby cars).
+ * 3. Lane Following (IDM behind the lane leader) on the main road, or
+ *    Collision Avoidance (Braking/repulsion from the footprints of nearby cars) elsewhere.
  * 4. Physics Integration (Apply forces to velocity and position).
  * 5. Visual Rotation (Smoothly lerp sprite rotation toward heading).
+ * 6. Level of Detail (isolated cruising cars skip full updates until their cruise horizon).
+ *
+ * Damping and smoothing factors are scaled by dt, so behaviour does not depend on the tick rate.
  *
  * @param dt Delta time in seconds.
- * @param cars Pointer to a vector of other cars for spatial awareness.
+ * @param neighbors Broadphase grid of the cars, for spatial awareness.
  */
-void Car::updateWithNeighbors(double dt, const std::vector<std::unique_ptr<Car>> *cars) {
+void Car::updateWithNeighbors(double dt, const SpatialGrid<Car *> *neighbors) {
+  previousPosition = position;
+  previousRotation = currentRotation;
 
   // 1. Handle Static States
   if (state == CarState::PARKED) {
-    parkingTimer -= (float)dt;
     return;
   }
 
-  // 2. Path Following (Seek Logic)
-  if (!waypoints.empty()) {
-    Waypoint &currentWp = waypoints.front();
-    seek(currentWp);
-
-    // Check if waypoint reached (within tolerance)
-    if (Vector2Distance(position, currentWp.position) < currentWp.tolerance) {
-      if (waypoints.size() == 1) {
-        // Transition to alignment/parking if this is the final waypoint
-        if (currentWp.stopAtEnd && state == CarState::DRIVING) {
-          velocity = {0, 0};
-          acceleration = {0, 0};
-          state = CarState::ALIGNING;
-          targetRotation = currentWp.entryAngle;
-        }
-      }
-      waypoints.pop_front();
-    }
+  // Cruising cars move in closed form until their horizon (nothing around them changes their
+  // course); a car coming close in the lane promotes them at once
+  bool cruising = simLod == SimLod::CRUISE && lane >= 0 && laneIsolated;
+  if (cruising && cruiseElapsed + (float)dt < cruiseHorizon) {
+    cruiseElapsed += (float)dt;
+    position = Vector2Add(cruiseOrigin, Vector2Scale(velocity, cruiseElapsed));
+    return;
+  }
+
+  // 2. Path Following (Pure Pursuit)
+  if (!hasArrived()) {
+    followPath();
   } else {
     // Logic for cars currently parking (Aligning to the spot angle)
     if (state == CarState::ALIGNING) {
@@ -135,56 +183,63 @@ void Car::updateWithNeighbors(double dt, const std::vector<std::unique_ptr<Car>>
       return;
     } else if (state == CarState::DRIVING) {
       // Apply friction/drag if no waypoints exist
-      velocity = Vector2Scale(velocity, 0.95f);
+      velocity = Vector2Scale(velocity, decayFactor(0.95f, dt));
     }
   }
 
-  // 3. Collision Avoidance and "Creep" Logic
-  if (cars && (state == CarState::DRIVING || state == CarState::EXITING)) {
+  // 3. Lane Following on the main road; Collision Avoidance and "Creep" Logic elsewhere
+  if (lane >= 0 && !hasArrived() && (state == CarState::DRIVING || state == CarState::EXITING)) {
+    followLeader(dt);
+  } else if (neighbors && (state == CarState::DRIVING || state == CarState::EXITING)) {
+    namespace A = Config::CarAI::Avoidance;
     // Determine current heading vector
     Vector2 heading = (Vector2Length(velocity) > 0.1f) ? Vector2Normalize(velocity)
-                                                       : Vector2{cosf((currentRotation - 90.0f) * DEG2RAD),
-                                                                 sinf((currentRotation - 90.0f) * DEG2RAD)};
+                                                       : Vector2{DetMath::Cos((currentRotation - 90.0f) * DEG2RAD),
+                                                                 DetMath::Sin((currentRotation - 90.0f) * DEG2RAD)};
     Vector2 sideVec = {-heading.y, heading.x};
 
     float currentSpeed = Vector2Length(velocity);
     float lookAheadDist = 7.0f + (currentSpeed * 2.0f);
-    float laneWidth = 1.8f;
-    float criticalStopDist = 3.2f;
-
-    for (const auto &other : *cars) {
-      if (other.get() == this || other->state == CarState::PARKED)
-        continue;
-
-      Vector2 toOther = Vector2Subtract(other->getPosition(), position);
-      float distSq = Vector2LengthSqr(toOther);
-
-      if (distSq > lookAheadDist * lookAheadDist)
-        continue;
 
+    // Own footprint, and the strip it sweeps over the look-ahead distance (from the rear bumper)
+    OrientedBox body = getFootprint();
+    OrientedBox sweep = {Vector2Add(position, Vector2Scale(heading, lookAheadDist * 0.5f)), heading,
+                         (Config::CarAI::CAR_LENGTH + lookAheadDist) * 0.5f,
+                         Config::CarAI::CAR_WIDTH * 0.5f + A::CLEARANCE};
+
+    // Broadphase: cars bucketed around both boxes
+    Rectangle a = body.bounds();
+    Rectangle b = sweep.bounds();
+    float minX = std::min(a.x, b.x);
+    float minY = std::min(a.y, b.y);
+    Rectangle area = {minX, minY, std::max(a.x + a.width, b.x + b.width) - minX,
+                      std::max(a.y + a.height, b.y + b.height) - minY};
+
+    neighbors->query(area, [&](Car *other) {
+      if (other == this || other->state == CarState::PARKED)
+        return;
+
+      OrientedBox box = other->getFootprint();
+      Vector2 toOther = Vector2Subtract(other->position, position);
       float dotForward = Vector2DotProduct(toOther, heading);
-      float dotSide = Vector2DotProduct(toOther, sideVec);
-
-      Vector2 otherHeading = (Vector2Length(other->velocity) > 0.1f) ? Vector2Normalize(other->velocity) : heading;
-      float alignment = Vector2DotProduct(heading, otherHeading);
 
-      // Detection Corridor: Check if 'other' is directly in front
-      if (dotForward > 0 && dotForward < lookAheadDist && fabsf(dotSide) < laneWidth) {
-
-        // Ignore oncoming traffic in adjacent lanes
-        if (alignment < -0.5f && fabsf(dotSide) > 1.0f)
-          continue;
+      // Detection: the other footprint lies in the strip ahead (cars beside the strip no longer stop us)
+      if (dotForward > 0 && Overlaps(sweep, box)) {
+        // Bumper gap: from our front to the nearest extent of the other box along our heading
+        float extent = fabsf(Vector2DotProduct(box.forward, heading)) * box.halfLength +
+                       fabsf(Vector2DotProduct({-box.forward.y, box.forward.x}, heading)) * box.halfWidth;
+        float gap = std::max(dotForward - Config::CarAI::CAR_LENGTH * 0.5f - extent, 0.0f);
 
         // A. Apply Braking Force proportional to proximity
-        float proximity = 1.0f - (dotForward / lookAheadDist);
+        float proximity = 1.0f - std::min(gap / lookAheadDist, 1.0f);
         float brakingForce = 45.0f * (proximity * proximity);
 
         // B. Critical Distance Damping
-        if (dotForward < criticalStopDist) {
+        if (gap < A::CRITICAL_GAP) {
           brakingForce += 60.0f;
           // Only force-damp if moving; allows for low-speed "creeping"
           if (currentSpeed > 0.3f) {
-            velocity = Vector2Scale(velocity, 0.85f);
+            velocity = Vector2Scale(velocity, decayFactor(0.85f, dt));
           }
         }
 
@@ -192,20 +247,19 @@ void Car::updateWithNeighbors(double dt, const std::vector<std::unique_ptr<Car>>
 
         // C. Deadlock Breaker: Lateral nudge if the car is stuck behind another
         if (currentSpeed < 0.5f) {
-          float steerDir = (dotSide > 0) ? -1.0f : 1.0f;
+          float steerDir = (Vector2DotProduct(toOther, sideVec) > 0) ? -1.0f : 1.0f;
           applyForce(Vector2Scale(sideVec, 40.0f * steerDir));
         }
       }
 
-      // D. Lateral Separation (Repulsion from nearby neighbors)
-      float dist = sqrtf(distSq);
-      if (dist < 1.9f) {
-        float pushStrength = 30.0f * (1.0f - (dist / 1.9f));
-        Vector2 pushDir = Vector2Normalize(toOther);
-        float lateralPush = Vector2DotProduct(pushDir, sideVec);
-        applyForce(Vector2Scale(sideVec, lateralPush * -pushStrength));
+      // D. Separation: only footprints that actually overlap push apart
+      Vector2 push;
+      if (Overlaps(body, box, &push)) {
+        float depth = Vector2Length(push);
+        float pushStrength = std::min(depth * A::SEPARATION_STIFFNESS, A::MAX_SEPARATION);
+        applyForce(Vector2Scale(push, pushStrength / depth));
       }
-    }
+    });
   }
 
   // 4. Physics Integration
@@ -232,74 +286,206 @@ void Car::updateWithNeighbors(double dt, const std::vector<std::unique_ptr<Car>>
     // 5. Smooth Rotation: Interpolate current rotation toward velocity vector
     float speed = Vector2Length(velocity);
     if (speed > 0.1f) {
-      float targetRot = atan2f(velocity.y, velocity.x) * RAD2DEG + 90.0f;
-      float angleDiff = targetRot - currentRotation;
-      while (angleDiff > 180)
-        angleDiff -= 360;
-      while (angleDiff < -180)
-        angleDiff += 360;
-      currentRotation += angleDiff * 0.12f;
+      float targetRot = DetMath::Atan2(velocity.y, velocity.x) * RAD2DEG + 90.0f;
+      currentRotation += angleDelta(currentRotation, targetRot) * lerpFactor(0.12f, dt);
     }
   }
 
+  // 6. Level of Detail for the next ticks (judged on this tick's forces)
+  simLod = canCruise() ? SimLod::CRUISE : SimLod::FULL;
+  if (simLod == SimLod::CRUISE) {
+    cruiseOrigin = position;
+    cruiseElapsed = 0.0f;
+    cruiseHorizon = cruiseTime();
+  }
+
   acceleration = {0, 0}; // Reset forces for next frame
 }
 
+bool Car::canCruise() const {
+  namespace L = Config::CarAI::SimLod;
+  if (!simLodEnabled || lane < 0 || !laneIsolated || hasArrived())
+    return false;
+  if (state != CarState::DRIVING && state != CarState::EXITING)
+    return false;
+
+  // Highway phase on a straight, long way from the next turn (manoeuvres have lower speed limits)
+  const Waypoint &wp = (*path)[pathCursor];
+  if (wp.speedLimitFactor < 1.0f || fabsf(wp.position.y - position.y) > Config::CarAI::Lanes::HALF_WIDTH)
+    return false;
+  if ((wp.position.x - position.x) * laneDirection < L::CLEAR_AHEAD)
+    return false;
+
+  // Steady: heading down the lane, neither speeding up nor braking
+  return velocity.x * laneDirection > 0.0f && fabsf(velocity.y) < 0.1f && Vector2Length(acceleration) < L::STEADY_ACCEL;
+}
+
+float Car::cruiseTime() const {
+  namespace L = Config::CarAI::SimLod;
+  float speed = velocity.x * laneDirection;
+  float toTurn = ((*path)[pathCursor].position.x - position.x) * laneDirection - L::CLEAR_AHEAD;
+  float horizon = std::min(toTurn / speed, L::MAX_CRUISE_TIME);
+
+  // Where the car could meet its leader, if closing in on it
+  if (leader) {
+    float room = (leader->position.x - position.x) * laneDirection - Config::CarAI::CAR_LENGTH - L::ISOLATION_GAP;
+    float closing = speed - leader->velocity.x * laneDirection;
+    if (closing > 0.0f)
+      horizon = std::min(horizon, room / closing);
+  }
+  return std::max(horizon, 0.0f);
+}
+
 /**
- * @brief Renders the car and optional debug information (paths/waypoints).
+ * @brief Records the car and optional debug information (paths/waypoints).
  * @param showPath If true, draws the car's planned trajectory.
  */
-void Car::draw(bool showPath) {
-  if (showPath && !waypoints.empty()) {
-    for (size_t i = 0; i < waypoints.size(); ++i) {
-      Vector2 wpPos = waypoints[i].position;
-      DrawCircleV(wpPos, 0.25f, Fade(BLUE, 0.5f));
-      if (i > 0) {
-        DrawLineV(waypoints[i - 1].position, wpPos, Fade(BLUE, 0.3f));
-      } else {
-        DrawLineV(position, wpPos, Fade(BLUE, 0.3f));
-      }
-    }
+void Car::draw(DrawList &out, bool showPath, bool pathMarkers, float alpha) const {
+  if (showPath) {
+    drawPath(out, pathMarkers, alpha);
   }
 
-  Texture2D tex = AssetManager::Get().GetTexture(textureName);
+  const Texture2D &tex = AssetManager::Get().GetTexture(texture);
 
-  // Convert pixel dimensions to meters using config scaling
-  float width = 17.0f / static_cast<float>(Config::ART_PIXELS_PER_METER);
-  float height = 31.0f / static_cast<float>(Config::ART_PIXELS_PER_METER);
+  // Sprite size in meters (the footprint)
+  float width = Config::CarAI::CAR_WIDTH;
+  float height = Config::CarAI::CAR_LENGTH;
 
   Rectangle source = {0, 0, (float)tex.width, (float)tex.height};
-  Rectangle dest = {position.x, position.y, width, height};
+  Vector2 pos = getRenderPosition(alpha);
+  Rectangle dest = {pos.x, pos.y, width, height};
   Vector2 origin = {width / 2.0f, height / 2.0f};
 
-  DrawTexturePro(tex, source, dest, origin, currentRotation, WHITE);
+  out.sprite(DrawLayer::VEHICLES, tex, source, dest, origin, getRenderRotation(alpha), WHITE);
+}
+
+void Car::draw() {
+  DrawList list;
+  draw(list, false);
+  list.submit();
+}
+
+void Car::drawPath(DrawList &out, bool markers, float alpha) const {
+  if (!path)
+    return;
+  const Path &wps = *path;
+  for (size_t i = pathCursor; i < wps.size(); ++i) {
+    Vector2 wpPos = wps[i].position;
+    if (markers) {
+      out.circle(DrawLayer::DEBUG, wpPos, 0.25f, Fade(BLUE, 0.5f));
+    }
+    if (i > pathCursor) {
+      out.line(DrawLayer::DEBUG, wps[i - 1].position, wpPos, 0.0f, Fade(BLUE, 0.3f));
+    } else {
+      out.line(DrawLayer::DEBUG, getRenderPosition(alpha), wpPos, 0.0f, Fade(BLUE, 0.3f));
+    }
+  }
 }
 
 /**
  * @brief Appends a single waypoint to the path.
  */
-void Car::addWaypoint(Waypoint wp) { waypoints.push_back(wp); }
+void Car::addWaypoint(Waypoint wp) {
+  std::vector<Waypoint> remaining;
+  remaining.reserve(getRemainingWaypoints() + 1);
+  for (size_t i = pathCursor; path && i < path->size(); ++i) {
+    remaining.push_back((*path)[i]);
+  }
+  remaining.push_back(wp);
+  setPath(remaining);
+}
 
 /**
- * @brief Replaces current waypoints with a new path.
+ * @brief Starts following a shared path.
  */
-void Car::setPath(const std::vector<Waypoint> &path) {
-  waypoints.clear();
-  for (const auto &wp : path) {
-    waypoints.push_back(wp);
-  }
+void Car::setPath(PathHandle newPath) {
+  path = std::move(newPath);
+  pathCursor = 0;
+  pathOrigin = position;
 }
 
+/**
+ * @brief Replaces current waypoints with a new path.
+ */
+void Car::setPath(const std::vector<Waypoint> &waypoints) { setPath(std::make_shared<const Path>(waypoints)); }
+
 /**
  * @brief Removes all waypoints from the path.
  */
-void Car::clearWaypoints() { waypoints.clear(); }
+void Car::clearWaypoints() { setPath(PathHandle{}); }
 
 /**
  * @brief Accumulates a force vector to be applied during the next physics update.
  */
 void Car::applyForce(Vector2 force) { acceleration = Vector2Add(acceleration, force); }
 
+namespace {
+/// Closest point parameter (0..1) of p on segment a-b.
+float projectOnSegment(Vector2 p, Vector2 a, Vector2 b) {
+  Vector2 ab = Vector2Subtract(b, a);
+  float lengthSq = Vector2LengthSqr(ab);
+  if (lengthSq < 1e-6f)
+    return 1.0f;
+  return std::clamp(Vector2DotProduct(Vector2Subtract(p, a), ab) / lengthSq, 0.0f, 1.0f);
+}
+} // namespace
+
+/**
+ * @brief Follows the path by pure pursuit.
+ *
+ * Waypoints are passed once the car is within their tolerance, or once its projection reaches
+ * the end of their segment (the final waypoint must be reached). The car then steers at a point
+ * further along the segments, evaluated on demand from the waypoints around the cursor.
+ */
+void Car::followPath() {
+  while (!hasArrived()) {
+    const Waypoint &currentWp = (*path)[pathCursor];
+    bool last = getRemainingWaypoints() == 1;
+    Vector2 from = pathCursor == 0 ? pathOrigin : (*path)[pathCursor - 1].position;
+
+    bool reached = Vector2Distance(position, currentWp.position) < currentWp.tolerance;
+    bool passed = !last && projectOnSegment(position, from, currentWp.position) >= 1.0f;
+    if (!reached && !passed)
+      break;
+
+    // Transition to alignment/parking if this is the final waypoint
+    if (last && currentWp.stopAtEnd && state == CarState::DRIVING) {
+      velocity = {0, 0};
+      acceleration = {0, 0};
+      state = CarState::ALIGNING;
+      targetRotation = currentWp.entryAngle;
+    }
+    pathCursor++;
+  }
+
+  if (hasArrived() || state == CarState::ALIGNING)
+    return;
+
+  float speed = Vector2Length(velocity);
+  float lookahead = std::min(Config::CarAI::LOOKAHEAD_MAX,
+                             Config::CarAI::LOOKAHEAD_MIN + speed * Config::CarAI::LOOKAHEAD_TIME);
+  seek((*path)[pathCursor], lookaheadPoint(lookahead));
+}
+
+Vector2 Car::lookaheadPoint(float lookahead) const {
+  const Waypoint &currentWp = (*path)[pathCursor];
+  Vector2 from = pathCursor == 0 ? pathOrigin : (*path)[pathCursor - 1].position;
+
+  // Walk along the current segment from the car's projection
+  float t = projectOnSegment(position, from, currentWp.position);
+  Vector2 closest = Vector2Lerp(from, currentWp.position, t);
+  float remaining = Vector2Distance(closest, currentWp.position);
+  if (lookahead <= remaining)
+    return Vector2Add(closest, Vector2Scale(Vector2Normalize(Vector2Subtract(currentWp.position, from)), lookahead));
+
+  // ...then round the corner into the next segment, within the waypoint's tolerance
+  if (currentWp.stopAtEnd || getRemainingWaypoints() < 2)
+    return currentWp.position;
+  Vector2 next = (*path)[pathCursor + 1].position;
+  float overflow = std::min(lookahead - remaining, currentWp.tolerance);
+  return Vector2Add(currentWp.position, Vector2Scale(Vector2Normalize(Vector2Subtract(next, currentWp.position)), overflow));
+}
+
 /**
  * @brief Calculates steering force toward a target using Seek/Arrive behaviors.
  *
@@ -308,13 +494,9 @@ void Car::applyForce(Vector2 force) { acceleration = Vector2Add(acceleration, fo
  * - Turn slowdown (reducing speed based on angle difference).
  * - Arrival damping (slowing down as the final destination is reached).
  */
-void Car::seek(const Waypoint &wp) {
-  Vector2 target = wp.position;
-  Vector2 desired = Vector2Subtract(target, position);
-  float dist = Vector2Length(desired);
-  desired = Vector2Normalize(desired);
-
-  float currentAngle = atan2f(velocity.y, velocity.x);
+float Car::targetSpeed(const Waypoint &wp) const {
+  float dist = Vector2Distance(position, wp.position);
+  float currentAngle = DetMath::Atan2(velocity.y, velocity.x);
 
   // 1. Base speed for this segment
   float limitSpeed = maxSpeed * wp.speedLimitFactor;
@@ -362,7 +544,12 @@ void Car::seek(const Waypoint &wp) {
     }
   }
 
-  desired = Vector2Scale(desired, speed);
+  return speed;
+}
+
+void Car::seek(const Waypoint &wp, Vector2 aim) {
+  Vector2 desired = Vector2Normalize(Vector2Subtract(aim, position));
+  desired = Vector2Scale(desired, targetSpeed(wp));
   Vector2 steer = Vector2Subtract(desired, velocity);
 
   // Clamp steering force to vehicle capabilities
@@ -372,3 +559,35 @@ void Car::seek(const Waypoint &wp) {
 
   applyForce(steer);
 }
+
+/**
+ * @brief Intelligent Driver Model along the lane.
+ *
+ * a = A * (1 - (v / v0)^4 - (s* / s)^2), with s* = s0 + v * T + v * dv / (2 * sqrt(A * B)),
+ * s the bumper-to-bumper gap and dv the closing speed. Steering (the lateral part of the
+ * pursuit force) is kept; only the acceleration along the lane is replaced.
+ */
+void Car::followLeader(double dt) {
+  namespace L = Config::CarAI::Lanes;
+  Vector2 dir = {laneDirection, 0.0f};
+
+  float v = Vector2DotProduct(velocity, dir);
+  float v0 = std::max(targetSpeed((*path)[pathCursor]), 0.1f);
+  float ratio = std::max(v, 0.0f) / v0;
+  float accel = L::ACCELERATION * (1.0f - (ratio * ratio) * (ratio * ratio));
+
+  if (leader) {
+    float gap = std::max((leader->position.x - position.x) * laneDirection - Config::CarAI::CAR_LENGTH, 0.1f);
+    float closing = v - Vector2DotProduct(leader->velocity, dir);
+    float desiredGap =
+        L::MIN_GAP + std::max(0.0f, v * L::TIME_HEADWAY + v * closing / (2.0f * sqrtf(L::ACCELERATION * L::COMFORT_DECEL)));
+    accel -= L::ACCELERATION * (desiredGap / gap) * (desiredGap / gap);
+  }
+
+  // Brake no harder than needed to stand still: cars in a lane never reverse
+  accel = std::max(accel, -L::MAX_DECEL);
+  accel = std::max(accel, -std::max(v, 0.0f) / (float)dt);
+
+  float along = Vector2DotProduct(acceleration, dir);
+  acceleration = Vector2Add(acceleration, Vector2Scale(dir, accel - along));
+}
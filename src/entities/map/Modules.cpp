@@ -30,7 +30,15 @@ void Module::assignRandomPricesToSpots(float baseSpotPrice, float variance) {
   }
 }
 
-void Module::draw() const {
+void Module::draw(DrawList &out) const {
+  const Texture2D &tex = AssetManager::Get().GetTexture(texture);
+  if (tex.id != 0) {
+    Rectangle source = {0, 0, (float)tex.width, (float)tex.height};
+    // Destination uses width/height in world units
+    Rectangle dest = {worldPosition.x, worldPosition.y, width, height};
+    out.sprite(DrawLayer::STATIC, tex, source, dest, {0, 0}, 0.0f, WHITE);
+  }
+
   // Default draw: outline (in Meters)
   // DrawRectangleLinesEx({worldPosition.x, worldPosition.y, width, height}, 0.1f, BLACK);
 
@@ -110,6 +118,12 @@ void Module::setSpotState(int index, SpotState state) {
   }
 }
 
+void Module::setSpotPrice(int index, float price) {
+  if (index >= 0 && index < (int)spots.size()) {
+    spots[index].price = price;
+  }
+}
+
 Module::SpotCounts Module::getSpotCounts() const {
   SpotCounts counts = {0, 0, 0};
   for (const auto &spot : spots) {
@@ -140,6 +154,8 @@ float Module::getOccupancyPercentage() const {
 // normal road : left (0 78) right (283 78) size (283 155)
 
 NormalRoad::NormalRoad() : Module(P2M(283), P2M(155)) {
+  texture = AssetManager::Get().GetTextureHandle("road");
+
   // Left: 0, 78 (art pixels)
   // Right: 283, 78
   // Y in meters = 78 / 7 = 11.14
@@ -155,18 +171,10 @@ NormalRoad::NormalRoad() : Module(P2M(283), P2M(155)) {
   addWaypoint({width / 2.0f, yCenter});
 }
 
-void NormalRoad::draw() const {
-  Texture2D tex = AssetManager::Get().GetTexture("road");
-  Rectangle source = {0, 0, (float)tex.width, (float)tex.height};
-  // DrawTexturePro destination uses width/height in world units
-  Rectangle dest = {worldPosition.x, worldPosition.y, width, height};
-  DrawTexturePro(tex, source, dest, {0, 0}, 0.0f, WHITE);
-
-  Module::draw();
-}
-
 // up entrance road : left (0 78) right (283 78) up(142 0) size (284 155)
 UpEntranceRoad::UpEntranceRoad() : Module(P2M(284), P2M(155)) {
+  texture = AssetManager::Get().GetTextureHandle("entrance_up");
+
   float yCenter = P2M(78);
   float xCenter = P2M(142);
 
@@ -177,16 +185,10 @@ UpEntranceRoad::UpEntranceRoad() : Module(P2M(284), P2M(155)) {
   addWaypoint({xCenter, yCenter});
 }
 
-void UpEntranceRoad::draw() const {
-  Texture2D tex = AssetManager::Get().GetTexture("entrance_up");
-  Rectangle source = {0, 0, (float)tex.width, (float)tex.height};
-  Rectangle dest = {worldPosition.x, worldPosition.y, width, height};
-  DrawTexturePro(tex, source, dest, {0, 0}, 0.0f, WHITE);
-  Module::draw();
-}
-
 // down entrance road : left (0 78) right (283 78) down(142 155) size (284 155)
 DownEntranceRoad::DownEntranceRoad() : Module(P2M(284), P2M(155)) {
+  texture = AssetManager::Get().GetTextureHandle("entrance_down");
+
   float yCenter = P2M(78);
   float xCenter = P2M(142);
 
@@ -197,16 +199,10 @@ DownEntranceRoad::DownEntranceRoad() : Module(P2M(284), P2M(155)) {
   addWaypoint({xCenter, yCenter});
 }
 
-void DownEntranceRoad::draw() const {
-  Texture2D tex = AssetManager::Get().GetTexture("entrance_down");
-  Rectangle source = {0, 0, (float)tex.width, (float)tex.height};
-  Rectangle dest = {worldPosition.x, worldPosition.y, width, height};
-  DrawTexturePro(tex, source, dest, {0, 0}, 0.0f, WHITE);
-  Module::draw();
-}
-
 // double entrance road : left (0 78) right (283 78) up(142 0) down(142 155) size (284 155)
 DoubleEntranceRoad::DoubleEntranceRoad() : Module(P2M(284), P2M(155)) {
+  texture = AssetManager::Get().GetTextureHandle("entrance_double");
+
   float yCenter = P2M(78);
   float xCenter = P2M(142);
 
@@ -218,14 +214,6 @@ DoubleEntranceRoad::DoubleEntranceRoad() : Module(P2M(284), P2M(155)) {
   addWaypoint({xCenter, yCenter});
 }
 
-void DoubleEntranceRoad::draw() const {
-  Texture2D tex = AssetManager::Get().GetTexture("entrance_double");
-  Rectangle source = {0, 0, (float)tex.width, (float)tex.height};
-  Rectangle dest = {worldPosition.x, worldPosition.y, width, height};
-  DrawTexturePro(tex, source, dest, {0, 0}, 0.0f, WHITE);
-  Module::draw();
-}
-
 // (Removed getEntryWaypoint implementation)
 
 // --- Facilities ---
@@ -236,6 +224,8 @@ small parking down : 218 0 (274*330)
 */
 
 SmallParking::SmallParking(bool isTop) : Module(P2M(274), P2M(330)), isTop(isTop) {
+  texture = AssetManager::Get().GetTextureHandle(isTop ? "parking_small_up" : "parking_small_down");
+
   if (isTop) {
     attachmentPoints.push_back({{P2M(218), height}, {0, 1}});
 
@@ -278,20 +268,13 @@ SmallParking::SmallParking(bool isTop) : Module(P2M(274), P2M(330)), isTop(isTop
   assignRandomPricesToSpots(2.0f, 0.5f);
 }
 
-void SmallParking::draw() const {
-  const char *texName = isTop ? "parking_small_up" : "parking_small_down";
-  Texture2D tex = AssetManager::Get().GetTexture(texName);
-  Rectangle source = {0, 0, (float)tex.width, (float)tex.height};
-  Rectangle dest = {worldPosition.x, worldPosition.y, width, height};
-  DrawTexturePro(tex, source, dest, {0, 0}, 0.0f, WHITE);
-  Module::draw();
-}
-
 /*
 large parking up : 218 363 (436*363)
 large parking down : 218 0 (436*363)
 */
 LargeParking::LargeParking(bool isTop) : Module(P2M(436), P2M(363)), isTop(isTop) {
+  texture = AssetManager::Get().GetTextureHandle(isTop ? "parking_large_up" : "parking_large_down");
+
   if (isTop) {
     attachmentPoints.push_back({{P2M(218), height}, {0, 1}});
 
@@ -341,20 +324,13 @@ LargeParking::LargeParking(bool isTop) : Module(P2M(436), P2M(363)), isTop(isTop
   assignRandomPricesToSpots(1.0f, 0.5f);
 }
 
-void LargeParking::draw() const {
-  const char *texName = isTop ? "parking_large_up" : "parking_large_down";
-  Texture2D tex = AssetManager::Get().GetTexture(texName);
-  Rectangle source = {0, 0, (float)tex.width, (float)tex.height};
-  Rectangle dest = {worldPosition.x, worldPosition.y, width, height};
-  DrawTexturePro(tex, source, dest, {0, 0}, 0.0f, WHITE);
-  Module::draw();
-}
-
 /*
 small charging up : 163 168 (219*168)
 small charging down : 163 0 (219*168)
 */
 SmallChargingStation::SmallChargingStation(bool isTop) : Module(P2M(219), P2M(168)), isTop(isTop) {
+  texture = AssetManager::Get().GetTextureHandle(isTop ? "charging_small_up" : "charging_small_down");
+
   if (isTop) {
     attachmentPoints.push_back({{P2M(163), height}, {0, 1}});
 
@@ -392,20 +368,13 @@ SmallChargingStation::SmallChargingStation(bool isTop) : Module(P2M(219), P2M(16
   assignRandomPricesToSpots(10.0f, 1.0f);
 }
 
-void SmallChargingStation::draw() const {
-  const char *texName = isTop ? "charging_small_up" : "charging_small_down";
-  Texture2D tex = AssetManager::Get().GetTexture(texName);
-  Rectangle source = {0, 0, (float)tex.width, (float)tex.height};
-  Rectangle dest = {worldPosition.x, worldPosition.y, width, height};
-  DrawTexturePro(tex, source, dest, {0, 0}, 0.0f, WHITE);
-  Module::draw();
-}
-
 /*
 large charging up : 218 330 (274*330)
 large charging down : 218 0 (274*330)
 */
 LargeChargingStation::LargeChargingStation(bool isTop) : Module(P2M(274), P2M(330)), isTop(isTop) {
+  texture = AssetManager::Get().GetTextureHandle(isTop ? "charging_large_up" : "charging_large_down");
+
   if (isTop) {
     attachmentPoints.push_back({{P2M(218), height}, {0, 1}});
     // Same layout as Small Parking UP
@@ -439,11 +408,3 @@ LargeChargingStation::LargeChargingStation(bool isTop) : Module(P2M(274), P2M(33
   assignRandomPricesToSpots(8.0f, 2.0f);
 }
 
-void LargeChargingStation::draw() const {
-  const char *texName = isTop ? "charging_large_up" : "charging_large_down";
-  Texture2D tex = AssetManager::Get().GetTexture(texName);
-  Rectangle source = {0, 0, (float)tex.width, (float)tex.height};
-  Rectangle dest = {worldPosition.x, worldPosition.y, width, height};
-  DrawTexturePro(tex, source, dest, {0, 0}, 0.0f, WHITE);
-  Module::draw();
-}
@@ -3,6 +3,7 @@
 #include "core/AssetManager.hpp"
 #include "core/Logger.hpp"
 #include "raylib.h"
+#include <algorithm>
 #include <cmath>
 
 /**
@@ -12,65 +13,52 @@
  * Handles background rendering (tiling) and global map visualization (grid, overlay).
  */
 
-World::World(float width, float height) : width(width), height(height), showGrid(false) {
-  // Load Textures
-  auto &AM = AssetManager::Get();
-  AM.LoadTexture("grass1", "assets/grass1.png");
-  AM.LoadTexture("grass2", "assets/grass2.png");
-  AM.LoadTexture("grass3", "assets/grass3.png");
-  AM.LoadTexture("grass4", "assets/grass4.png");
-
-  //sound icones
-  //AM.LoadTexture("sound_on", "assets/sound_on.png");
-  //AM.LoadTexture("sound_off", "assets/volume-mute.png");
-
-  // Load Module Textures
-  AM.LoadTexture("road", "assets/road.png");
-  AM.LoadTexture("entrance_up", "assets/entrance_up.png");
-  AM.LoadTexture("entrance_down", "assets/entrance_down.png");
-  AM.LoadTexture("entrance_double", "assets/entrance_double.png");
-
-  AM.LoadTexture("parking_small_up", "assets/parking_small_up.png");
-  AM.LoadTexture("parking_small_down", "assets/parking_small_down.png");
-  AM.LoadTexture("parking_large_up", "assets/parking_large_up.png");
-  AM.LoadTexture("parking_large_down", "assets/parking_large_down.png");
-
-  AM.LoadTexture("charging_small_up", "assets/charging_small_up.png");
-  AM.LoadTexture("charging_small_down", "assets/charging_small_down.png");
-  AM.LoadTexture("charging_large_up", "assets/charging_large_up.png");
-  AM.LoadTexture("charging_large_down", "assets/charging_large_down.png");
-
-  // Load Car Textures
-  AM.LoadTexture("car11", "assets/car11.png");
-  AM.LoadTexture("car12", "assets/car12.png");
-  AM.LoadTexture("car13", "assets/car13.png");
-
-  AM.LoadTexture("car21", "assets/car21.png");
-  AM.LoadTexture("car22", "assets/car22.png");
-  AM.LoadTexture("car23", "assets/car23.png");
-
-  tileTextures = {"grass1", "grass2", "grass3", "grass4"};
-
-  // Calculate Tile Size in Meters
+namespace {
+float tileSizeMeters() {
   // BACKGROUND_TILE_SIZE art pixels per tile
   // ART_PIXELS_PER_METER = 7
-  float artPixelsPerTile = static_cast<float>(Config::BACKGROUND_TILE_SIZE);
-  tileWidthMeter = artPixelsPerTile / static_cast<float>(Config::ART_PIXELS_PER_METER);
-  tileHeightMeter = tileWidthMeter;
+  return static_cast<float>(Config::BACKGROUND_TILE_SIZE) / static_cast<float>(Config::ART_PIXELS_PER_METER);
+}
+} // namespace
 
-  // Generate Tile Map
-  int cols = std::ceil(width / tileWidthMeter);
-  int rows = std::ceil(height / tileHeightMeter);
+int World::TileColumns(float width) { return (int)std::ceil(width / tileSizeMeters()); }
+int World::TileRows(float height) { return (int)std::ceil(height / tileSizeMeters()); }
 
-  backgroundTiles.resize(rows, std::vector<int>(cols));
+World::World(float width, float height) : width(width), height(height), showGrid(false) {
+  initTiles();
 
-  for (int y = 0; y < rows; ++y) {
-    for (int x = 0; x < cols; ++x) {
-      backgroundTiles[y][x] = GetRandomValue(0, tileTextures.size() - 1);
+  // Generate Tile Map
+  for (auto &row : backgroundTiles) {
+    for (int &tile : row) {
+      tile = GetRandomValue(0, tileTextures.size() - 1);
     }
   }
 
-  Logger::Info("World initialized with {}x{} background tiles.", cols, rows);
+  Logger::Info("World initialized with {}x{} background tiles.", getTileColumns(), getTileRows());
+}
+
+World::World(float width, float height, std::span<const std::uint8_t> tiles)
+    : width(width), height(height), showGrid(false) {
+  initTiles();
+
+  int cols = getTileColumns();
+  for (std::size_t i = 0; i < tiles.size() && i < (std::size_t)cols * backgroundTiles.size(); ++i) {
+    // Out of range indices (a snapshot from a build with more grass variants) wrap around
+    backgroundTiles[i / cols][i % cols] = tiles[i] % tileTextures.size();
+  }
+}
+
+void World::initTiles() {
+  // Textures are loaded from the asset manifest at startup; only resolve their handles here
+  auto &AM = AssetManager::Get();
+  tileTextures = {AM.GetTextureHandle("grass1"), AM.GetTextureHandle("grass2"), AM.GetTextureHandle("grass3"),
+                  AM.GetTextureHandle("grass4")};
+
+  // Calculate Tile Size in Meters
+  tileWidthMeter = tileSizeMeters();
+  tileHeightMeter = tileWidthMeter;
+
+  backgroundTiles.assign(TileRows(height), std::vector<int>(TileColumns(width), 0));
 }
 
 void World::update(double /*dt*/) {
@@ -78,43 +66,66 @@ void World::update(double /*dt*/) {
 }
 
 void World::draw() {
-  // Draw Background Tiles
+  DrawList list;
+  drawBackground({0, 0, width, height}, list);
+  list.submit();
+}
+
+void World::drawBackground(Rectangle area, DrawList &out) {
+  if (backgroundTiles.empty())
+    return;
+
+  // Only walk the tile rows/columns overlapping the requested area
+  int rows = (int)backgroundTiles.size();
+  int cols = (int)backgroundTiles[0].size();
+  int minX = std::max(0, (int)std::floor(area.x / tileWidthMeter));
+  int maxX = std::min(cols - 1, (int)std::floor((area.x + area.width) / tileWidthMeter));
+  int minY = std::max(0, (int)std::floor(area.y / tileHeightMeter));
+  int maxY = std::min(rows - 1, (int)std::floor((area.y + area.height) / tileHeightMeter));
+
   auto &AM = AssetManager::Get();
 
-  for (size_t y = 0; y < backgroundTiles.size(); ++y) {
-    for (size_t x = 0; x < backgroundTiles[y].size(); ++x) {
+  for (int y = minY; y <= maxY; ++y) {
+    for (int x = minX; x <= maxX; ++x) {
       int tileIndex = backgroundTiles[y][x];
-      Texture2D tex = AM.GetTexture(tileTextures[tileIndex]);
+      const Texture2D &tex = AM.GetTexture(tileTextures[tileIndex]);
 
       Rectangle source = {0, 0, (float)tex.width, (float)tex.height};
       Rectangle dest = {x * tileWidthMeter, y * tileHeightMeter, tileWidthMeter, tileHeightMeter};
       Vector2 origin = {0, 0};
 
-      DrawTexturePro(tex, source, dest, origin, 0.0f, WHITE);
+      out.sprite(DrawLayer::BACKGROUND, tex, source, dest, origin, 0.0f, WHITE);
     }
   }
 }
 
-void World::drawOverlay() {
+void World::drawOverlay(Rectangle view, DrawList &out) {
   // Draw World Boundary (in Meters)
   // User wanted this over everything
-  DrawRectangleLinesEx({0, 0, width, height}, 0.1f, BLACK);
+  out.rectLines(DrawLayer::OVERLAY, {0, 0, width, height}, 0.1f, BLACK);
 
   // Draw Grid
   if (showGrid) {
-    // Grid lines every 1 meter
+    // Grid lines every 1 meter, only the ones crossing the view
     float spacing = 1.0f;
 
-    for (float x = 0; x <= width; x += spacing) {
-      DrawLineV({x, 0}, {x, height}, Fade(LIGHTGRAY, 0.3f));
+    float minX = std::max(0.0f, std::floor(view.x / spacing) * spacing);
+    float maxX = std::min(width, view.x + view.width);
+    float minY = std::max(0.0f, std::floor(view.y / spacing) * spacing);
+    float maxY = std::min(height, view.y + view.height);
+    if (minX > maxX || minY > maxY)
+      return;
+
+    for (float x = minX; x <= maxX; x += spacing) {
+      out.line(DrawLayer::OVERLAY, {x, minY}, {x, maxY}, 0.0f, Fade(LIGHTGRAY, 0.3f));
     }
-    for (float y = 0; y <= height; y += spacing) {
-      DrawLineV({0, y}, {width, y}, Fade(LIGHTGRAY, 0.3f));
+    for (float y = minY; y <= maxY; y += spacing) {
+      out.line(DrawLayer::OVERLAY, {minX, y}, {maxX, y}, 0.0f, Fade(LIGHTGRAY, 0.3f));
     }
   }
 }
 
-void World::drawMask() {
+void World::drawMask(DrawList &out) {
   // Draw 4 rectangles to cover everything outside [0, 0, width, height]
   // Color: Dark Gray/Black
   Color maskColor = {20, 20, 20, 255};
@@ -124,14 +135,14 @@ void World::drawMask() {
   float hugeMargin = 10000.0f;
 
   // Top
-  DrawRectangleRec({-hugeMargin, -hugeMargin, width + 2 * hugeMargin, hugeMargin}, maskColor);
+  out.rect(DrawLayer::MASK, {-hugeMargin, -hugeMargin, width + 2 * hugeMargin, hugeMargin}, maskColor);
 
   // Bottom
-  DrawRectangleRec({-hugeMargin, height, width + 2 * hugeMargin, hugeMargin}, maskColor);
+  out.rect(DrawLayer::MASK, {-hugeMargin, height, width + 2 * hugeMargin, hugeMargin}, maskColor);
 
   // Left
-  DrawRectangleRec({-hugeMargin, 0, hugeMargin, height}, maskColor);
+  out.rect(DrawLayer::MASK, {-hugeMargin, 0, hugeMargin, height}, maskColor);
 
   // Right
-  DrawRectangleRec({width, 0, hugeMargin, height}, maskColor);
+  out.rect(DrawLayer::MASK, {width, 0, hugeMargin, height}, maskColor);
 }
@@ -2,6 +2,7 @@
 #include "config.hpp"
 #include "core/Logger.hpp"
 #include "entities/map/Modules.hpp"
+#include "entities/map/WorldSnapshot.hpp"
 #include "raymath.h"
 #include <algorithm>
 #include <random>
@@ -18,9 +19,31 @@ struct PlannedUnit {
   std::unique_ptr<Module> bottomFacility;
 };
 
-GeneratedMap WorldGenerator::generate(const MapConfig &config) {
+GeneratedMap WorldGenerator::create(const MapConfig &config, std::atomic<float> *progress) {
+  if (!config.snapshotPath.empty()) {
+    if (auto snapshot = WorldSnapshot::Load(config.snapshotPath)) {
+      Logger::Info("Loaded World from {}", config.snapshotPath);
+      if (progress)
+        progress->store(1.0f);
+      return std::move(*snapshot);
+    }
+    // A missing or stale snapshot falls back to a freshly generated map
+  }
+  return generate(config, progress);
+}
+
+GeneratedMap WorldGenerator::generate(const MapConfig &config, std::atomic<float> *progress) {
   Logger::Info("Generating World...");
 
+  // Planning (module construction) is most of the work, placement the rest
+  const int facilityTotal =
+      config.smallParkingCount + config.largeParkingCount + config.smallChargingCount + config.largeChargingCount;
+  auto report = [&](float fraction) {
+    if (progress)
+      progress->store(std::clamp(fraction, 0.0f, 1.0f));
+  };
+  report(0.0f);
+
   std::vector<std::unique_ptr<Module>> modules;
   std::vector<PlannedUnit> plan;
   std::random_device rd;
@@ -102,6 +125,9 @@ GeneratedMap WorldGenerator::generate(const MapConfig &config) {
     if (unit.bottomFacility)
       unit.bottomFacility->setParent(unit.road.get());
     plan.push_back(std::move(unit));
+
+    int placed = facilityTotal - (smallParkingLeft + largeParkingLeft + smallChargingLeft + largeChargingLeft);
+    report(0.6f * (float)placed / (float)std::max(1, facilityTotal));
   }
 
   // 2. PLACEMENT
@@ -124,7 +150,9 @@ GeneratedMap WorldGenerator::generate(const MapConfig &config) {
   placeRoadAt(currentX, startY);
   safeX_road = currentX;
 
-  for (auto &unit : plan) {
+  for (std::size_t unitIndex = 0; unitIndex < plan.size(); ++unitIndex) {
+    PlannedUnit &unit = plan[unitIndex];
+    report(0.6f + 0.3f * (float)unitIndex / (float)plan.size());
     bool collision = true;
     while (collision) {
       collision = false;
@@ -233,5 +261,6 @@ GeneratedMap WorldGenerator::generate(const MapConfig &config) {
   modules.push_back(std::move(extR));
 
   auto world = std::make_unique<World>(worldWidth, worldHeight);
+  report(1.0f);
   return {std::move(world), std::move(modules)};
 }
@@ -0,0 +1,256 @@
+#include "entities/map/WorldSnapshot.hpp"
+#include "core/Logger.hpp"
+#include <cstring>
+#include <fstream>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @file WorldSnapshot.cpp
+ * @brief Implementation of the world snapshot format.
+ */
+
+namespace {
+constexpr char MAGIC[4] = {'P', 'L', 'W', 'S'};
+
+std::size_t modulesOffset() { return sizeof(WorldSnapshotHeader); }
+std::size_t pricesOffset(const WorldSnapshotHeader &h) {
+  return modulesOffset() + std::size_t(h.moduleCount) * sizeof(WorldSnapshotModule);
+}
+std::size_t tilesOffset(const WorldSnapshotHeader &h) { return pricesOffset(h) + std::size_t(h.priceCount) * sizeof(float); }
+std::size_t fileSize(const WorldSnapshotHeader &h) {
+  return tilesOffset(h) + std::size_t(h.tileColumns) * h.tileRows;
+}
+
+std::optional<SnapshotModuleKind> kindOf(const Module &mod) {
+  switch (mod.getType()) {
+  case ModuleType::SMALL_PARKING:
+    return SnapshotModuleKind::SMALL_PARKING;
+  case ModuleType::LARGE_PARKING:
+    return SnapshotModuleKind::LARGE_PARKING;
+  case ModuleType::SMALL_CHARGING:
+    return SnapshotModuleKind::SMALL_CHARGING;
+  case ModuleType::LARGE_CHARGING:
+    return SnapshotModuleKind::LARGE_CHARGING;
+  default:
+    break;
+  }
+  // Roads share a type; tell them apart by class
+  if (dynamic_cast<const NormalRoad *>(&mod))
+    return SnapshotModuleKind::NORMAL_ROAD;
+  if (dynamic_cast<const UpEntranceRoad *>(&mod))
+    return SnapshotModuleKind::UP_ENTRANCE_ROAD;
+  if (dynamic_cast<const DownEntranceRoad *>(&mod))
+    return SnapshotModuleKind::DOWN_ENTRANCE_ROAD;
+  if (dynamic_cast<const DoubleEntranceRoad *>(&mod))
+    return SnapshotModuleKind::DOUBLE_ENTRANCE_ROAD;
+  return std::nullopt;
+}
+
+std::unique_ptr<Module> createModule(SnapshotModuleKind kind, bool isTop) {
+  switch (kind) {
+  case SnapshotModuleKind::NORMAL_ROAD:
+    return std::make_unique<NormalRoad>();
+  case SnapshotModuleKind::UP_ENTRANCE_ROAD:
+    return std::make_unique<UpEntranceRoad>();
+  case SnapshotModuleKind::DOWN_ENTRANCE_ROAD:
+    return std::make_unique<DownEntranceRoad>();
+  case SnapshotModuleKind::DOUBLE_ENTRANCE_ROAD:
+    return std::make_unique<DoubleEntranceRoad>();
+  case SnapshotModuleKind::SMALL_PARKING:
+    return std::make_unique<SmallParking>(isTop);
+  case SnapshotModuleKind::LARGE_PARKING:
+    return std::make_unique<LargeParking>(isTop);
+  case SnapshotModuleKind::SMALL_CHARGING:
+    return std::make_unique<SmallChargingStation>(isTop);
+  case SnapshotModuleKind::LARGE_CHARGING:
+    return std::make_unique<LargeChargingStation>(isTop);
+  default:
+    return nullptr;
+  }
+}
+} // namespace
+
+bool WorldSnapshot::Write(const std::string &file, const World &world,
+                          const std::vector<std::unique_ptr<Module>> &modules) {
+  std::unordered_map<const Module *, std::int32_t> indexOf;
+  for (std::size_t i = 0; i < modules.size(); ++i)
+    indexOf[modules[i].get()] = static_cast<std::int32_t>(i);
+
+  std::vector<WorldSnapshotModule> records(modules.size());
+  std::vector<float> prices;
+  for (std::size_t i = 0; i < modules.size(); ++i) {
+    const Module &mod = *modules[i];
+    auto kind = kindOf(mod);
+    if (!kind) {
+      Logger::Error("Cannot snapshot module {}: unknown module class", i);
+      return false;
+    }
+
+    WorldSnapshotModule &record = records[i];
+    record.kind = static_cast<std::uint16_t>(*kind);
+    record.isTop = mod.isUp() ? 1 : 0;
+    record.parent = -1;
+    if (const Module *parent = mod.getParent()) {
+      auto it = indexOf.find(parent);
+      if (it == indexOf.end()) {
+        Logger::Error("Cannot snapshot module {}: parent is not part of the world", i);
+        return false;
+      }
+      record.parent = it->second;
+    }
+    record.x = mod.worldPosition.x;
+    record.y = mod.worldPosition.y;
+    record.priceMultiplier = mod.getPriceMultiplier();
+    record.firstPrice = static_cast<std::uint32_t>(prices.size());
+    record.spotCount = static_cast<std::uint32_t>(mod.getSpotCount());
+    for (int s = 0; s < (int)mod.getSpotCount(); ++s)
+      prices.push_back(mod.getSpot(s).price);
+  }
+
+  std::vector<std::uint8_t> tiles;
+  tiles.reserve(std::size_t(world.getTileColumns()) * world.getTileRows());
+  for (int row = 0; row < world.getTileRows(); ++row)
+    for (int col = 0; col < world.getTileColumns(); ++col)
+      tiles.push_back(static_cast<std::uint8_t>(world.getTile(col, row)));
+
+  WorldSnapshotHeader header{};
+  std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.version = VERSION;
+  header.moduleCount = static_cast<std::uint32_t>(records.size());
+  header.priceCount = static_cast<std::uint32_t>(prices.size());
+  header.worldWidth = world.getWidth();
+  header.worldHeight = world.getHeight();
+  header.tileColumns = static_cast<std::uint32_t>(world.getTileColumns());
+  header.tileRows = static_cast<std::uint32_t>(world.getTileRows());
+
+  std::ofstream out(file, std::ios::binary | std::ios::trunc);
+  if (!out) {
+    Logger::Error("Cannot write world snapshot: {}", file);
+    return false;
+  }
+
+  out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  out.write(reinterpret_cast<const char *>(records.data()),
+            static_cast<std::streamsize>(records.size() * sizeof(WorldSnapshotModule)));
+  out.write(reinterpret_cast<const char *>(prices.data()), static_cast<std::streamsize>(prices.size() * sizeof(float)));
+  out.write(reinterpret_cast<const char *>(tiles.data()), static_cast<std::streamsize>(tiles.size()));
+
+  if (!out)
+    return false;
+  Logger::Info("Saved world snapshot {} ({} modules, {} spots)", file, records.size(), prices.size());
+  return true;
+}
+
+bool WorldSnapshot::open(const std::string &file) {
+  close();
+  if (!data.open(file))
+    return false;
+
+  auto fail = [this, &file](const char *reason) {
+    Logger::Warn("Ignoring world snapshot {}: {}", file, reason);
+    close();
+    return false;
+  };
+
+  if (data.size() < sizeof(WorldSnapshotHeader))
+    return fail("truncated header");
+  // Records are read in place: the mapping (or read buffer) must suit the widest field
+  if (reinterpret_cast<std::uintptr_t>(data.data()) % alignof(WorldSnapshotModule) != 0)
+    return fail("misaligned data");
+
+  const WorldSnapshotHeader &h = header();
+  if (std::memcmp(h.magic, MAGIC, sizeof(MAGIC)) != 0)
+    return fail("not a world snapshot");
+  if (h.version != VERSION)
+    return fail("unsupported version");
+  if (data.size() < fileSize(h))
+    return fail("truncated data");
+  if (h.tileColumns != (std::uint32_t)World::TileColumns(h.worldWidth) ||
+      h.tileRows != (std::uint32_t)World::TileRows(h.worldHeight))
+    return fail("tile grid does not match the world size");
+
+  auto records = modules();
+  for (std::size_t i = 0; i < records.size(); ++i) {
+    const WorldSnapshotModule &record = records[i];
+    if (record.kind >= static_cast<std::uint16_t>(SnapshotModuleKind::COUNT))
+      return fail("unknown module kind");
+    if (record.parent < -1 || record.parent >= (std::int32_t)records.size() || record.parent == (std::int32_t)i)
+      return fail("parent out of range");
+    if (record.firstPrice > h.priceCount || record.spotCount > h.priceCount - record.firstPrice)
+      return fail("spot prices out of range");
+  }
+
+  // Parents may come later in the list, so cycles (A -> B -> A) are found by walking each chain
+  // once: a walk that meets a module of its own chain has looped
+  enum : std::uint8_t { UNSEEN, WALKING, DONE };
+  std::vector<std::uint8_t> state(records.size(), UNSEEN);
+  for (std::size_t start = 0; start < records.size(); ++start) {
+    std::int32_t i = (std::int32_t)start;
+    while (i >= 0 && state[i] == UNSEEN) {
+      state[i] = WALKING;
+      i = records[i].parent;
+    }
+    if (i >= 0 && state[i] == WALKING)
+      return fail("parent cycle");
+    for (i = (std::int32_t)start; i >= 0 && state[i] == WALKING; i = records[i].parent)
+      state[i] = DONE;
+  }
+
+  Logger::Info("Opened world snapshot {} ({} modules, {})", file, records.size(), data.isMapped() ? "mapped" : "read");
+  return true;
+}
+
+void WorldSnapshot::close() { data.close(); }
+
+const WorldSnapshotHeader &WorldSnapshot::header() const {
+  return *reinterpret_cast<const WorldSnapshotHeader *>(data.data());
+}
+
+std::span<const WorldSnapshotModule> WorldSnapshot::modules() const {
+  return {reinterpret_cast<const WorldSnapshotModule *>(data.data() + modulesOffset()), header().moduleCount};
+}
+
+std::span<const float> WorldSnapshot::prices() const {
+  return {reinterpret_cast<const float *>(data.data() + pricesOffset(header())), header().priceCount};
+}
+
+std::span<const std::uint8_t> WorldSnapshot::tiles() const {
+  const WorldSnapshotHeader &h = header();
+  return {data.data() + tilesOffset(h), std::size_t(h.tileColumns) * h.tileRows};
+}
+
+GeneratedMap WorldSnapshot::instantiate() const {
+  GeneratedMap map;
+  const WorldSnapshotHeader &h = header();
+  map.world = std::make_unique<World>(h.worldWidth, h.worldHeight, tiles());
+
+  auto records = modules();
+  auto spotPrices = prices();
+  map.modules.reserve(records.size());
+  for (const WorldSnapshotModule &record : records) {
+    auto mod = createModule(static_cast<SnapshotModuleKind>(record.kind), record.isTop != 0);
+    mod->worldPosition = {record.x, record.y};
+    mod->setPriceMultiplier(record.priceMultiplier);
+    // Constructors rebuild the spot layout; a record from another layout only restores what fits
+    int count = std::min<int>((int)record.spotCount, (int)mod->getSpotCount());
+    for (int s = 0; s < count; ++s)
+      mod->setSpotPrice(s, spotPrices[record.firstPrice + s]);
+    map.modules.push_back(std::move(mod));
+  }
+
+  // Parents may come later in the list (facilities are placed before their road)
+  for (std::size_t i = 0; i < records.size(); ++i) {
+    if (records[i].parent >= 0)
+      map.modules[i]->setParent(map.modules[records[i].parent].get());
+  }
+
+  return map;
+}
+
+std::optional<GeneratedMap> WorldSnapshot::Load(const std::string &file) {
+  WorldSnapshot snapshot;
+  if (!snapshot.open(file))
+    return std::nullopt;
+  return snapshot.instantiate();
+}
@@ -37,6 +37,10 @@ void InputSystem::update() {
   // Always publish move (UI needs this for hover states)
   eventBus->publish(MouseMovedEvent{logPos});
 
+  float wheel = GetMouseWheelMove();
+  if (wheel != 0)
+    eventBus->publish(MouseWheelEvent{wheel});
+
   // Mouse Clicks
   // Use MOUSE_BUTTON_LEFT (Raylib 5.0+)
   if (IsMouseButtonPressed(MOUSE_BUTTON_LEFT))
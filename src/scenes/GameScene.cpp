@@ -3,13 +3,18 @@
 #include "config.hpp"
 #include "core/EntityManager.hpp"
 #include "core/Logger.hpp"
+#include "core/ThreadPool.hpp"
 #include "events/GameEvents.hpp"
 #include "events/InputEvents.hpp"
 #include "raymath.h"
 #include "systems/CameraSystem.hpp"
+#include "systems/StatisticsSystem.hpp"
 #include "systems/TrafficSystem.hpp"
 #include "ui/GameHUD.hpp"
+#include <algorithm>
+#include <chrono>
 #include <format>
+#include <fstream>
 
 /**
  * @file GameScene.cpp
@@ -19,7 +24,8 @@
  * and the main game update/draw logic.
  */
 
-GameScene::GameScene(std::shared_ptr<EventBus> bus, MapConfig config) : eventBus(bus), config(config) {}
+GameScene::GameScene(std::shared_ptr<EventBus> bus, MapConfig config, ThreadPool *workers)
+    : eventBus(bus), config(config), workers(workers) {}
 
 GameScene::~GameScene() { Logger::Info("GameScene Destroyed"); }
 
@@ -32,10 +38,27 @@ void GameScene::load() {
   cameraSystem = std::make_unique<CameraSystem>(eventBus);
   entityManager = std::make_unique<EntityManager>(eventBus);
   trafficSystem = std::make_unique<TrafficSystem>(eventBus, *entityManager);
+  statisticsSystem = std::make_unique<StatisticsSystem>(eventBus, *entityManager);
   gameHUD = std::make_unique<GameHUD>(eventBus, entityManager.get());
 
-  // Generate World via Event
-  eventBus->publish(GenerateWorldEvent{config});
+  // Simulation systems: registration order settles who goes first when two touch the same state
+  scheduler.clear();
+  scheduler.setWorkers(workers);
+  entityManager->schedule(scheduler);
+  cameraSystem->schedule(scheduler);
+  statisticsSystem->schedule(scheduler);
+  trackingSystem->schedule(scheduler);
+  trafficSystem->schedule(scheduler);
+
+  // Build the world: on a worker behind a loading screen when possible, otherwise right here via event
+  if (workers) {
+    loadProgress = std::make_shared<std::atomic<float>>(0.0f);
+    pendingMap = workers->submit([config = config, progress = loadProgress]() {
+      return WorldGenerator::create(config, progress.get());
+    });
+  } else {
+    eventBus->publish(GenerateWorldEvent{config});
+  }
 
   // Setup Camera
   cameraSystem->setZoom(1.0f);
@@ -49,6 +72,13 @@ void GameScene::load() {
       Logger::Info("Switching to MainMenu");
       eventBus->publish(SceneChangeEvent{SceneType::MainMenu, {}});
     }
+    if (e.key == KEY_F5) {
+      eventBus->publish(SaveWorldEvent{Config::WORLD_SNAPSHOT_PATH});
+    }
+    if (e.key == KEY_F6) {
+      std::ofstream(Config::SYSTEM_GRAPH_PATH) << scheduler.toDot();
+      Logger::Info("System graph written to {}", Config::SYSTEM_GRAPH_PATH);
+    }
     if (e.key == KEY_P) {
       if (isPaused) {
         eventBus->publish(GameResumedEvent{});
@@ -139,41 +169,97 @@ void GameScene::load() {
     }
   }));
 
-  // Camera Zoom is now handled by CameraSystem
+  // Interpolation factor for this frame's draw
+  eventTokens.push_back(
+      eventBus->subscribe<PreRenderEvent>([this](const PreRenderEvent &e) { renderAlpha = e.alpha; }));
+
+  // Mouse wheel zooms the camera
+  eventTokens.push_back(eventBus->subscribe<MouseWheelEvent>(
+      [this](const MouseWheelEvent &e) { eventBus->publish(CameraZoomEvent{e.move * 0.1f}); }));
 }
 
 void GameScene::unload() {
+  // Module and world constructors draw from raylib's global RNG, so a world still being built
+  // must finish before the next scene can start another one; the result is dropped
+  if (pendingMap.valid()) {
+    Logger::Info("Waiting for world generation to finish before unloading");
+    pendingMap.wait();
+    pendingMap = {};
+  }
+  scheduler.clear();
   entityManager->clear();
   eventTokens.clear();
 }
 
-void GameScene::handleInput() {
-  // Camera movement is now handled by CameraSystem
-
-  float wheel = GetMouseWheelMove();
-  if (wheel != 0) {
-    eventBus->publish(CameraZoomEvent{wheel * 0.1f});
+void GameScene::update(double dt) {
+  if (isLoading()) {
+    pollPendingMap();
+    return;
   }
-}
 
-void GameScene::update(double dt) {
   gameHUD->update(dt);
 
   if (!isPaused) {
+    scheduler.tick(dt);
+    // Listeners outside the simulation (redraw tracking) follow the tick by event
     eventBus->publish(GameUpdateEvent{dt});
   }
 }
 
+void GameScene::pollPendingMap() {
+  float progress = loadProgress->load();
+  if (progress != reportedProgress) {
+    reportedProgress = progress;
+    eventBus->publish(WorldLoadProgressEvent{progress});
+  }
+
+  if (pendingMap.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+    return;
+
+  // Swapped in whole between ticks, so no system ever sees a half-built map
+  entityManager->setMap(pendingMap.get());
+  Logger::Info("World ready");
+}
+
+void GameScene::drawLoadingScreen() const {
+  ClearBackground({20, 20, 20, 255});
+
+  const char *label = "Generating world...";
+  int fontSize = 40;
+  float cx = Config::LOGICAL_WIDTH / 2.0f;
+  float cy = Config::LOGICAL_HEIGHT / 2.0f;
+  DrawText(label, (int)(cx - MeasureText(label, fontSize) / 2.0f), (int)(cy - 80), fontSize, RAYWHITE);
+
+  Rectangle bar = {cx - 300.0f, cy - 15.0f, 600.0f, 30.0f};
+  float fraction = std::max(0.0f, reportedProgress);
+  DrawRectangleRec({bar.x, bar.y, bar.width * fraction, bar.height}, SKYBLUE);
+  DrawRectangleLinesEx(bar, 2.0f, RAYWHITE);
+}
+
 void GameScene::draw() {
-  handleInput();
+  if (isLoading()) {
+    drawLoadingScreen();
+    return;
+  }
+
+  // Blend moving things between the last two ticks; hold the latest tick while paused
+  float alpha = isPaused ? 1.0f : renderAlpha;
+  trackingSystem->follow(alpha);
+  cameraSystem->setRenderAlpha(alpha);
+
+  // Record the world, culled to the view, then submit it sorted and batched
+  Rectangle view = cameraSystem->getVisibleArea();
+  worldDrawList.clear();
+  worldDrawList.setCullArea(view);
+  eventBus->publish(DrawWorldEvent{view, cameraSystem->getLod(), &worldDrawList, alpha});
 
   // Create a render camera that applies the PPM scaling
   eventBus->publish(BeginCameraEvent{});
   ClearBackground(RAYWHITE);
-
-  eventBus->publish(DrawWorldEvent{});
-
+  worldDrawList.submit();
   eventBus->publish(EndCameraEvent{});
 
-  gameHUD->draw();
+  hudDrawList.clear();
+  gameHUD->draw(hudDrawList);
+  hudDrawList.submit();
 }
@@ -8,6 +8,8 @@
 MainMenuScene::MainMenuScene(std::shared_ptr<EventBus> bus) : eventBus(bus) {}
 
 void MainMenuScene::load() {
+  background = AssetManager::Get().GetTextureHandle("menu_bg");
+
   float cx = Config::LOGICAL_WIDTH / 2.0f;
   float cy = Config::LOGICAL_HEIGHT / 2.0f;
   float btnWidth = 200.0f;
@@ -30,7 +32,7 @@ void MainMenuScene::load() {
 void MainMenuScene::unload() {}
 void MainMenuScene::update(double dt) { ui.update(dt); }
 void MainMenuScene::draw() {
-  Texture2D bg = AssetManager::Get().GetTexture("menu_bg");
+  const Texture2D &bg = AssetManager::Get().GetTexture(background);
     DrawTexturePro(bg, 
         { 0, 0, (float)bg.width, (float)bg.height }, 
         { 0, 0, (float)Config::LOGICAL_WIDTH, (float)Config::LOGICAL_HEIGHT }, 
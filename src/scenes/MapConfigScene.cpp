@@ -2,11 +2,14 @@
 #include "core/AssetManager.hpp"
 #include "config.hpp"
 #include "ui/UIButton.hpp"
+#include <filesystem>
 #include <string>
 
 MapConfigScene::MapConfigScene(std::shared_ptr<EventBus> bus) : eventBus(bus) {}
 
 void MapConfigScene::load() {
+  background = AssetManager::Get().GetTextureHandle("config_bg");
+
   float cx = Config::LOGICAL_WIDTH / 2.0f;
   float cy = Config::LOGICAL_HEIGHT / 2.0f;
   float rowHeight = 50.0f;
@@ -64,6 +67,18 @@ void MapConfigScene::load() {
   playBtn->setOnClick([this]() { eventBus->publish(SceneChangeEvent{SceneType::Game, config}); });
 
   ui.add(playBtn);
+
+  // Replay the world saved in game (F5) instead of generating a new one
+  if (std::filesystem::exists(Config::WORLD_SNAPSHOT_PATH)) {
+    auto loadBtn = std::make_shared<UIButton>(Vector2{cx - playBtnWidth / 2, startY + 5 * (rowHeight + spacing) + 20},
+                                              Vector2{playBtnWidth, rowHeight}, "LOAD SAVED", eventBus);
+    loadBtn->setOnClick([this]() {
+      MapConfig saved = config;
+      saved.snapshotPath = Config::WORLD_SNAPSHOT_PATH;
+      eventBus->publish(SceneChangeEvent{SceneType::Game, saved});
+    });
+    ui.add(loadBtn);
+  }
 }
 
 void MapConfigScene::unload() {}
@@ -71,7 +86,7 @@ void MapConfigScene::unload() {}
 void MapConfigScene::update(double dt) { ui.update(dt); }
 
 void MapConfigScene::draw() {
-  Texture2D bg = AssetManager::Get().GetTexture("config_bg");
+  const Texture2D &bg = AssetManager::Get().GetTexture(background);
     DrawTexturePro(bg, 
         { 0, 0, (float)bg.width, (float)bg.height }, 
         { 0, 0, (float)Config::LOGICAL_WIDTH, (float)Config::LOGICAL_HEIGHT }, 
@@ -4,7 +4,7 @@
 #include "scenes/MainMenuScene.hpp"
 #include "scenes/MapConfigScene.hpp"
 
-SceneManager::SceneManager(std::shared_ptr<EventBus> bus) : eventBus(bus) {
+SceneManager::SceneManager(std::shared_ptr<EventBus> bus, ThreadPool *workers) : eventBus(bus), workers(workers) {
   // Subscribe to SceneChangeEvent to handle scene transitions requested by other components
   sceneChangeToken = eventBus->subscribe<SceneChangeEvent>([this](const SceneChangeEvent &e) {
     changeQueued = true;
@@ -41,11 +41,12 @@ void SceneManager::setScene(SceneType type) {
     currentScene = std::make_unique<MapConfigScene>(eventBus);
     break;
   case SceneType::Game:
-    currentScene = std::make_unique<GameScene>(eventBus, nextConfig);
+    currentScene = std::make_unique<GameScene>(eventBus, nextConfig, workers);
     break;
   }
   if (currentScene) {
     currentScene->load();
     Logger::Info("Scene Loaded");
+    eventBus->publish(SceneLoadedEvent{type});
   }
 }
@@ -0,0 +1,111 @@
+#include "systems/AudioSystem.hpp"
+#include "config.hpp"
+#include "core/Logger.hpp"
+#include "events/GameEvents.hpp"
+#include "raylib.h"
+#include <chrono>
+#include <string>
+
+/**
+ * @file AudioSystem.cpp
+ * @brief Implementation of the threaded audio system.
+ */
+
+AudioSystem::AudioSystem(std::shared_ptr<EventBus> bus) : eventBus(bus) {
+  eventTokens.push_back(eventBus->subscribe<PlaySoundEvent>([this](const PlaySoundEvent &e) {
+    if (!ready || e.sound != SoundEffect::CLICK)
+      return;
+    {
+      std::lock_guard lock(mutex);
+      pendingClicks++;
+    }
+    wake.notify_one();
+  }));
+
+  thread = std::thread([this]() { run(); });
+}
+
+AudioSystem::~AudioSystem() {
+  {
+    std::lock_guard lock(mutex);
+    stopping = true;
+  }
+  wake.notify_one();
+  thread.join();
+}
+
+void AudioSystem::setMuted(bool mute) {
+  {
+    std::lock_guard lock(mutex);
+    muted = mute;
+    muteChanged = true;
+  }
+  wake.notify_one();
+}
+
+void AudioSystem::run() {
+  auto start = std::chrono::steady_clock::now();
+
+  InitAudioDevice();
+  if (!IsAudioDeviceReady()) {
+    Logger::Warn("Audio device unavailable; running without sound");
+    return;
+  }
+
+  Music music = LoadMusicStream(Config::Audio::MUSIC_PATH);
+  bool musicLoaded = IsMusicValid(music);
+  if (musicLoaded) {
+    SetMusicVolume(music, Config::Audio::MUSIC_VOLUME);
+    PlayMusicStream(music);
+  }
+
+  Sound click = LoadSound(Config::Audio::CLICK_SOUND_PATH);
+  if (click.frameCount == 0) {
+    // Attempt to load from an alternative path if the first fails
+    click = LoadSound((std::string("../") + Config::Audio::CLICK_SOUND_PATH).c_str());
+  }
+  bool clickLoaded = click.frameCount > 0;
+  if (clickLoaded) {
+    SetSoundVolume(click, Config::Audio::CLICK_VOLUME);
+  }
+
+  ready = true;
+  Logger::Info("Audio ready in {:.0f} ms (music: {}, click: {})",
+               std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count(),
+               musicLoaded ? "yes" : "no", clickLoaded ? "yes" : "no");
+
+  // Feed loop: keep the music buffers full and apply requests
+  std::unique_lock lock(mutex);
+  while (!stopping) {
+    if (muteChanged) {
+      SetMasterVolume(muted ? 0.0f : Config::Audio::MASTER_VOLUME);
+      muteChanged = false;
+    }
+
+    int clicks = pendingClicks;
+    pendingClicks = 0;
+
+    lock.unlock();
+    if (clicks > 0 && clickLoaded) {
+      StopSound(click); // Stop any previous button sound (to avoid overlap)
+      PlaySound(click);
+    }
+    if (musicLoaded) {
+      UpdateMusicStream(music);
+    }
+    lock.lock();
+
+    wake.wait_for(lock, std::chrono::milliseconds(Config::Audio::FEED_INTERVAL_MS),
+                  [this]() { return stopping || muteChanged || pendingClicks > 0; });
+  }
+  lock.unlock();
+
+  ready = false;
+  if (clickLoaded) {
+    UnloadSound(click);
+  }
+  if (musicLoaded) {
+    UnloadMusicStream(music);
+  }
+  CloseAudioDevice();
+}
@@ -4,6 +4,7 @@
 #include "events/GameEvents.hpp"
 #include "events/InputEvents.hpp"
 #include "events/TrackingEvents.hpp"
+#include "raymath.h"
 
 /**
  * @file CameraSystem.cpp
@@ -35,13 +36,14 @@ CameraSystem::CameraSystem(std::shared_ptr<EventBus> bus) : eventBus(bus) {
   // Subscribe to Move Event
   eventTokens.push_back(eventBus->subscribe<CameraMoveEvent>([this](const CameraMoveEvent &e) {
     if (this->isTracking) {
-      camera.target = e.delta;
+      camera.target = previousTarget = e.delta;
     } else {
     // Correct for speed multiplier if this comes from update loop?
     // Actually CameraMoveEvent comes mainly from external (if any).
     // Standard movement is in update() below.
     camera.target.x += e.delta.x;
     camera.target.y += e.delta.y;
+    previousTarget = camera.target;
     }
   }));
 
@@ -58,9 +60,6 @@ CameraSystem::CameraSystem(std::shared_ptr<EventBus> bus) : eventBus(bus) {
       speedMultiplier = 1.0; // Safety
   }));
 
-  // Subscribe to GameUpdateEvent
-  eventTokens.push_back(eventBus->subscribe<GameUpdateEvent>([this](const GameUpdateEvent &e) { this->update(e.dt); }));
-
   // Subscribe to WorldBoundsEvent
   eventTokens.push_back(eventBus->subscribe<WorldBoundsEvent>([this](const WorldBoundsEvent &e) {
     this->setWorldBounds(e.width, e.height);
@@ -70,7 +69,7 @@ CameraSystem::CameraSystem(std::shared_ptr<EventBus> bus) : eventBus(bus) {
 
   // Subscribe to Render Events
   eventTokens.push_back(eventBus->subscribe<BeginCameraEvent>([this](const BeginCameraEvent &) {
-    Camera2D renderCamera = camera;
+    Camera2D renderCamera = getCamera();
     renderCamera.zoom *= Config::PPM;
     BeginMode2D(renderCamera);
   }));
@@ -85,7 +84,7 @@ CameraSystem::CameraSystem(std::shared_ptr<EventBus> bus) : eventBus(bus) {
         this->camera.zoom = 1.0f; 
         // إعادة الكاميرا لمنتصف العالم لكي لا تبقى في الفراغ الأبيض
         if (this->worldWidth > 0 && this->worldHeight > 0) {
-        this->camera.target = { worldWidth / 2.0f, worldHeight / 2.0f };
+        this->setTarget({ worldWidth / 2.0f, worldHeight / 2.0f });
         }   
       } else {
         // زوم تلقائي عند بدء التتبع
@@ -103,6 +102,35 @@ void CameraSystem::setWorldBounds(float width, float height) {
   boundsSet = true;
 }
 
+Camera2D CameraSystem::getCamera() const {
+  Camera2D drawn = camera;
+  drawn.target = Vector2Lerp(previousTarget, camera.target, renderAlpha);
+  return drawn;
+}
+
+Rectangle CameraSystem::getVisibleArea() const {
+  // Same scaling as the render camera (zoom * PPM); rotation is never used
+  Camera2D drawn = getCamera();
+  float scale = drawn.zoom * Config::PPM;
+  return {drawn.target.x - drawn.offset.x / scale, drawn.target.y - drawn.offset.y / scale,
+          Config::LOGICAL_WIDTH / scale, Config::LOGICAL_HEIGHT / scale};
+}
+
+RenderLod CameraSystem::getLod() const {
+  if (camera.zoom < Config::Render::LOD_FAR_ZOOM)
+    return RenderLod::FAR;
+  if (camera.zoom < Config::Render::LOD_MID_ZOOM)
+    return RenderLod::MID;
+  return RenderLod::NEAR;
+}
+
+void CameraSystem::schedule(SystemScheduler &scheduler) {
+  scheduler.add("camera", Config::TICK_RATE, {0, SimState::CAMERA}, [this](double dt) {
+    previousTarget = camera.target;
+    update(dt);
+  });
+}
+
 void CameraSystem::update(double dt) {
 
   if (isTracking) return;
@@ -1,5 +1,6 @@
 #include "systems/PathPlanner.hpp"
 #include "config.hpp"
+#include "core/DetMath.hpp"
 #include "raymath.h"
 #include <cmath>
 
@@ -8,7 +9,7 @@
  * @brief Implementation of the Path Finding algorithms.
  *
  * Uses geometric knowledge of the modules (T-Junctions, Lane Offsets)
- * to construct Bezier-like or Linear paths made of Waypoints.
+ * to construct paths of straight segments between a few Waypoints.
  */
 
 // --- Constants for Waypoint Geometry ---
@@ -24,19 +25,25 @@ static constexpr float ENTRANCE_LANE_OFFSET_X = 18.0f;
 // Helper to convert art pixels to meters
 static float P2M(float artPixels) { return artPixels / static_cast<float>(Config::ART_PIXELS_PER_METER); }
 
+Lane PathPlanner::MainRoadLane(const Car *car) { return (car->getVelocity().x > 0) ? Lane::DOWN : Lane::UP; }
+
 std::vector<Waypoint> PathPlanner::GeneratePath(const Car *car, const Module *targetFac, const Spot &targetSpot) {
   std::vector<Waypoint> path;
 
   // 1. Determine Horizontal Lane on the Main Road
-  Lane mainRoadLane = (car->getVelocity().x > 0) ? Lane::DOWN : Lane::UP;
+  Waypoint wpEntry = RoadEntryPoint(targetFac, MainRoadLane(car));
+
+  AppendApproach(path, car->getPosition(), wpEntry);
+  AppendParkingRoute(path, targetFac, targetSpot, wpEntry);
+
+  return path;
+}
 
+Waypoint PathPlanner::RoadEntryPoint(const Module *targetFac, Lane mainRoadLane) {
   // 2. Determine Facility Orientation and Entry Side
   bool isUpFacility = targetFac->isUp();
   bool useRightSideEntry = isUpFacility; // Up -> Right, Down -> Left
 
-  // Track current position for segment generation
-  Vector2 currentPos = car->getPosition();
-
   // 3. Waypoint 1: Road Entry Point
   // Phase: APPROACH
   Module *parentRoad = targetFac->getParent();
@@ -45,7 +52,10 @@ std::vector<Waypoint> PathPlanner::GeneratePath(const Car *car, const Module *ta
 
   // Set Angle
   wpEntry.entryAngle = isUpFacility ? -PI / 2.0f : PI / 2.0f;
+  return wpEntry;
+}
 
+void PathPlanner::AppendApproach(std::vector<Waypoint> &path, Vector2 currentPos, const Waypoint &wpEntry) {
   // Split the Approach:
   // If the distance to the entry is long (> 40m), drive in HIGHWAY mode first.
   // Then switch to APPROACH mode for the last 30m (where braking might occur).
@@ -74,36 +84,35 @@ std::vector<Waypoint> PathPlanner::GeneratePath(const Car *car, const Module *ta
     wpPre.entryAngle = 0.0f; // No sharp turn expected here
     wpPre.stopAtEnd = false;
 
-    AddSegment(path, currentPos, wpPre, Config::CarAI::Phases::HIGHWAY);
-    currentPos = prePos;
+    AddSegment(path, wpPre, Config::CarAI::Phases::HIGHWAY);
   }
 
-  AddSegment(path, currentPos, wpEntry, Config::CarAI::Phases::APPROACH);
-  currentPos = wpEntry.position; // Update head
+  AddSegment(path, wpEntry, Config::CarAI::Phases::APPROACH);
+}
+
+void PathPlanner::AppendParkingRoute(std::vector<Waypoint> &path, const Module *targetFac, const Spot &targetSpot,
+                                     const Waypoint &wpEntry) {
+  bool useRightSideEntry = targetFac->isUp();
 
   // 4. Waypoint 2: Facility Entry Point (Gate)
   // Phase: ACCESS
   Waypoint wpGate = CalculateFacilityEntry(targetFac, useRightSideEntry);
   wpGate.entryAngle = wpEntry.entryAngle; // Vertical
 
-  AddSegment(path, currentPos, wpGate, Config::CarAI::Phases::ACCESS);
-  currentPos = wpGate.position;
+  AddSegment(path, wpGate, Config::CarAI::Phases::ACCESS);
 
   // 5. Waypoint 3: Alignment Point
   // Phase: MANEUVER
   Waypoint wpAlign = CalculateAlignmentPoint(targetFac, targetSpot);
   wpAlign.entryAngle = targetSpot.orientation;
 
-  AddSegment(path, currentPos, wpAlign, Config::CarAI::Phases::MANEUVER);
-  currentPos = wpAlign.position;
+  AddSegment(path, wpAlign, Config::CarAI::Phases::MANEUVER);
 
   // 6. Waypoint 4: Final Parking Spot
   // Phase: PARKING
   Waypoint wpSpot = CalculateSpotPoint(targetFac, targetSpot);
 
-  AddSegment(path, currentPos, wpSpot, Config::CarAI::Phases::PARKING);
-
-  return path;
+  AddSegment(path, wpSpot, Config::CarAI::Phases::PARKING);
 }
 
 Waypoint PathPlanner::CalculateRoadEntry(const Module *road, Lane roadLane, bool useRightSideEntry) {
@@ -172,7 +181,7 @@ Waypoint PathPlanner::CalculateAlignmentPoint(const Module *facility, const Spot
   Vector2 spotGlobal = Vector2Add(facility->worldPosition, spot.localPosition);
   float backAngle = spot.orientation + PI;
   float dist = 8.0f;
-  Vector2 offset = {cosf(backAngle) * dist, sinf(backAngle) * dist};
+  Vector2 offset = {DetMath::Cos(backAngle) * dist, DetMath::Sin(backAngle) * dist};
   Vector2 alignPos = Vector2Add(spotGlobal, offset);
 
   return Waypoint(alignPos);
@@ -186,15 +195,21 @@ Waypoint PathPlanner::CalculateSpotPoint(const Module *facility, const Spot &spo
 std::vector<Waypoint> PathPlanner::GenerateExitPath(const Car *car, const Module *currentFac, const Spot &currentSpot,
                                                     bool exitRight, float finalX) {
   std::vector<Waypoint> path;
-  Vector2 currentPos = car->getPosition();
+  AppendUnpark(path, currentFac, currentSpot);
+  AppendExitRoute(path, currentFac, exitRight, finalX, car->getPosition().y);
+  return path;
+}
 
+void PathPlanner::AppendUnpark(std::vector<Waypoint> &path, const Module *currentFac, const Spot &currentSpot) {
   // 1. Waypoint 1: Alignment Point (Reverse)
   // Phase: MANEUVER
   Waypoint wpAlign = CalculateAlignmentPoint(currentFac, currentSpot);
   // Spot->Align is slow
-  AddSegment(path, currentPos, wpAlign, Config::CarAI::Phases::MANEUVER);
-  currentPos = wpAlign.position;
+  AddSegment(path, wpAlign, Config::CarAI::Phases::MANEUVER);
+}
 
+void PathPlanner::AppendExitRoute(std::vector<Waypoint> &path, const Module *currentFac, bool exitRight, float finalX,
+                                  float fallbackY) {
   // 2. Waypoint 2: Facility Exit Point (Gate)
   // Phase: ACCESS
   bool isUpFac = currentFac->isUp();
@@ -203,8 +218,7 @@ std::vector<Waypoint> PathPlanner::GenerateExitPath(const Car *car, const Module
   Waypoint wpGate = CalculateFacilityEntry(currentFac, useRightSideExit);
   wpGate.entryAngle = isUpFac ? PI / 2.0f : -PI / 2.0f;
 
-  AddSegment(path, currentPos, wpGate, Config::CarAI::Phases::ACCESS);
-  currentPos = wpGate.position;
+  AddSegment(path, wpGate, Config::CarAI::Phases::ACCESS);
 
   // 3. Waypoint 3: Road Entry/Exit Point
   // Phase: ACCESS
@@ -216,8 +230,7 @@ std::vector<Waypoint> PathPlanner::GenerateExitPath(const Car *car, const Module
     Waypoint wpRoad = CalculateRoadEntry(parentRoad, exitLane, roadConnectorSide);
     wpRoad.entryAngle = exitRight ? 0.0f : PI;
 
-    AddSegment(path, currentPos, wpRoad, Config::CarAI::Phases::ACCESS);
-    currentPos = wpRoad.position;
+    AddSegment(path, wpRoad, Config::CarAI::Phases::ACCESS);
   }
 
   // 4. Waypoint 4: Map Edge Exit
@@ -227,46 +240,17 @@ std::vector<Waypoint> PathPlanner::GenerateExitPath(const Car *car, const Module
     float laneOffset = (exitRight) ? P2M(Config::LANE_OFFSET_DOWN) : P2M(Config::LANE_OFFSET_UP);
     yPos = parentRoad->worldPosition.y + laneOffset;
   } else {
-    yPos = car->getPosition().y;
+    yPos = fallbackY;
   }
 
   Waypoint wpEdge({finalX, yPos}, 1.0f, -1, 0.0f, true);
 
-  AddSegment(path, currentPos, wpEdge, Config::CarAI::Phases::HIGHWAY);
-
-  return path;
+  AddSegment(path, wpEdge, Config::CarAI::Phases::HIGHWAY);
 }
 
-void PathPlanner::AddSegment(std::vector<Waypoint> &path, Vector2 startPos, Waypoint target,
-                             const Config::CarAI::AIPhase &phase) {
-  // 1. Calculate Segment distance
-  float dist = Vector2Distance(startPos, target.position);
-
-  // 2. Determine number of correction points
-  // If step is 15m and dist is 45m -> 3 steps -> 2 intermediate points?
-  // count = floor(dist / step)
-
-  if (phase.correctionStep > 0.0f && dist > phase.correctionStep) {
-    int steps = std::max(1, (int)(dist / phase.correctionStep));
-
-    for (int k = 1; k < steps; ++k) {
-      float t = (float)k / (float)steps;
-      Vector2 newPos = Vector2Lerp(startPos, target.position, t);
-
-      Waypoint wpCorr = target; // Inherit target properties (angle/ID potentially)
-      wpCorr.position = newPos;
-      wpCorr.id = -100; // Debug ID
-      wpCorr.stopAtEnd = false;
-
-      // Apply Phase Config
-      wpCorr.tolerance = phase.tolerance;
-      wpCorr.speedLimitFactor = phase.speedFactor;
-
-      path.push_back(wpCorr);
-    }
-  }
-
-  // 3. Add the actual target waypoint
+void PathPlanner::AddSegment(std::vector<Waypoint> &path, Waypoint target, const Config::CarAI::AIPhase &phase) {
+  // Segments stay straight lines between waypoints: cars follow them by pure pursuit
+  // (Car::followPath), so no intermediate correction points are needed
   target.tolerance = phase.tolerance;
   target.speedLimitFactor = phase.speedFactor;
 
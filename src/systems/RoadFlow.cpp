@@ -0,0 +1,148 @@
+#include "systems/RoadFlow.hpp"
+#include "config.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+/**
+ * @file RoadFlow.cpp
+ * @brief Cell transmission model of the main road's through-traffic.
+ */
+
+void RoadFlow::build(const std::vector<std::unique_ptr<Module>> &modules) {
+  clear();
+
+  // The main road: every road module in the row of the first one
+  const Module *first = nullptr;
+  float maxX = std::numeric_limits<float>::lowest();
+  minX = std::numeric_limits<float>::max();
+  for (const auto &mod : modules) {
+    if (mod->getType() != ModuleType::ROAD)
+      continue;
+    if (!first)
+      first = mod.get();
+    if (std::fabs(mod->worldPosition.y - first->worldPosition.y) > 0.01f)
+      continue;
+    minX = std::min(minX, mod->worldPosition.x);
+    maxX = std::max(maxX, mod->worldPosition.x + mod->getWidth());
+  }
+  if (!first)
+    return;
+
+  float length = maxX - minX;
+  std::size_t count = std::max<std::size_t>(1, (std::size_t)std::ceil(length / Config::Flow::CELL_LENGTH));
+  cellLength = length / (float)count;
+
+  const float pixelsPerMeter = static_cast<float>(Config::ART_PIXELS_PER_METER);
+  float top = first->worldPosition.y;
+  links.push_back({top + Config::LANE_OFFSET_DOWN / pixelsPerMeter, true, std::vector<float>(count, 0.0f)});
+  links.push_back({top + Config::LANE_OFFSET_UP / pixelsPerMeter, false, std::vector<float>(count, 0.0f)});
+  transfers.assign(count, 0.0f);
+}
+
+void RoadFlow::clear() {
+  links.clear();
+  transfers.clear();
+  minX = 0.0f;
+  cellLength = 0.0f;
+}
+
+RoadFlow::Link *RoadFlow::find(bool towardsRight) {
+  for (Link &link : links)
+    if (link.towardsRight == towardsRight)
+      return &link;
+  return nullptr;
+}
+
+const RoadFlow::Link *RoadFlow::find(bool towardsRight) const {
+  for (const Link &link : links)
+    if (link.towardsRight == towardsRight)
+      return &link;
+  return nullptr;
+}
+
+void RoadFlow::addVehicles(bool towardsRight, float count) {
+  if (Link *link = find(towardsRight))
+    link->queue += count;
+}
+
+void RoadFlow::step(float dt) {
+  using namespace Config::Flow;
+  // Backward wave speed of the triangular fundamental diagram
+  constexpr float waveSpeed = CAPACITY / (JAM_DENSITY - CAPACITY / FREE_SPEED);
+
+  const float maxFlow = CAPACITY * dt;
+  const float jamCount = JAM_DENSITY * cellLength;
+
+  for (Link &link : links) {
+    auto &cells = link.cells;
+    const std::size_t count = cells.size();
+
+    // What each cell sends downstream, limited by what the next one can take (all from the old state)
+    auto sending = [&](std::size_t i) { return std::min({FREE_SPEED * dt / cellLength * cells[i], maxFlow, cells[i]}); };
+    auto receiving = [&](std::size_t i) {
+      return std::clamp(waveSpeed * dt / cellLength * (jamCount - cells[i]), 0.0f, maxFlow);
+    };
+
+    for (std::size_t i = 0; i < count; ++i)
+      transfers[i] = (i + 1 < count) ? std::min(sending(i), receiving(i + 1)) : sending(i);
+    float entering = std::min(link.queue, receiving(0));
+
+    for (std::size_t i = 0; i < count; ++i) {
+      cells[i] -= transfers[i];
+      if (i + 1 < count)
+        cells[i + 1] += transfers[i];
+    }
+    cells[0] += entering;
+    link.queue -= entering;
+    link.exited += transfers[count - 1];
+  }
+}
+
+void RoadFlow::draw(Rectangle view, DrawList &out) const {
+  constexpr float laneWidth = 2.5f;
+  const float jamCount = Config::Flow::JAM_DENSITY * cellLength;
+
+  for (const Link &link : links) {
+    if (link.y + laneWidth < view.y || link.y - laneWidth > view.y + view.height)
+      continue;
+    for (std::size_t i = 0; i < link.cells.size(); ++i) {
+      float fill = std::min(link.cells[i] / jamCount, 1.0f);
+      if (fill < 0.005f)
+        continue;
+      // Cells are numbered in driving order
+      std::size_t column = link.towardsRight ? i : link.cells.size() - 1 - i;
+      Rectangle rec = {minX + column * cellLength, link.y - laneWidth / 2, cellLength, laneWidth};
+      if (!CheckCollisionRecs(rec, view))
+        continue;
+      out.rect(DrawLayer::DECALS, rec, Fade(ColorLerp(GREEN, RED, fill), 0.25f + 0.4f * fill));
+    }
+  }
+}
+
+float RoadFlow::getVehiclesOnRoad() const {
+  float total = 0.0f;
+  for (const Link &link : links)
+    for (float n : link.cells)
+      total += n;
+  return total;
+}
+
+float RoadFlow::getQueuedVehicles() const {
+  float total = 0.0f;
+  for (const Link &link : links)
+    total += link.queue;
+  return total;
+}
+
+double RoadFlow::getExitedVehicles() const {
+  double total = 0.0;
+  for (const Link &link : links)
+    total += link.exited;
+  return total;
+}
+
+float RoadFlow::getDensity(bool towardsRight, std::size_t cell) const {
+  const Link *link = find(towardsRight);
+  return (link && cell < link->cells.size()) ? link->cells[cell] / cellLength : 0.0f;
+}
@@ -0,0 +1,112 @@
+#include "systems/RouteTable.hpp"
+#include "core/Logger.hpp"
+#include "raymath.h"
+#include "systems/PathPlanner.hpp"
+#include <algorithm>
+#include <limits>
+
+/**
+ * @file RouteTable.cpp
+ * @brief Precomputation and lookup of facility routes.
+ */
+
+void RouteTable::build(const std::vector<std::unique_ptr<Module>> &modules) {
+  clear();
+
+  // Road span (external roads are NormalRoads), used for the map edge exits
+  float minX = std::numeric_limits<float>::max();
+  float maxX = std::numeric_limits<float>::lowest();
+  for (const auto &mod : modules) {
+    if (dynamic_cast<const NormalRoad *>(mod.get())) {
+      minX = std::min(minX, mod->worldPosition.x);
+      maxX = std::max(maxX, mod->worldPosition.x + mod->getWidth());
+    }
+  }
+  minRoadX = (minX == std::numeric_limits<float>::max()) ? 0.0f : minX;
+  maxRoadX = (maxX == std::numeric_limits<float>::lowest()) ? 100.0f : maxX;
+
+  std::vector<Waypoint> all;
+  std::vector<Route> exitRoutes; // Wrapped into shared paths once the array is final
+  auto record = [&all](auto &&appendTo) {
+    Route route;
+    route.first = static_cast<std::uint32_t>(all.size());
+    appendTo(all);
+    route.count = static_cast<std::uint32_t>(all.size()) - route.first;
+    return route;
+  };
+
+  for (const auto &mod : modules) {
+    const Module *facility = mod.get();
+    if (facility->getSpotCount() == 0)
+      continue;
+
+    firstSpot[facility] = static_cast<std::uint32_t>(spots.size());
+    for (int s = 0; s < (int)facility->getSpotCount(); ++s) {
+      Spot spot = facility->getSpot(s);
+      SpotRoutes routes;
+
+      for (Lane lane : {Lane::UP, Lane::DOWN}) {
+        int l = static_cast<int>(lane);
+        routes.roadEntry[l] = PathPlanner::RoadEntryPoint(facility, lane);
+        routes.entry[l] = record([&](std::vector<Waypoint> &out) {
+          PathPlanner::AppendParkingRoute(out, facility, spot, routes.roadEntry[l]);
+        });
+      }
+
+      // A parked car sits on its spot, so the spot's lane Y stands in for the car's
+      float spotY = facility->worldPosition.y + spot.localPosition.y;
+      for (bool exitRight : {false, true}) {
+        float finalX = exitRight ? (maxRoadX + 2.0f) : (minRoadX - 2.0f);
+        exitRoutes.push_back(record([&](std::vector<Waypoint> &out) {
+          PathPlanner::AppendUnpark(out, facility, spot);
+          PathPlanner::AppendExitRoute(out, facility, exitRight, finalX, spotY);
+        }));
+      }
+
+      spots.push_back(routes);
+    }
+  }
+
+  waypoints = std::make_shared<const std::vector<Waypoint>>(std::move(all));
+  for (std::size_t i = 0; i < spots.size(); ++i) {
+    spots[i].exit[0] = makePath({}, exitRoutes[2 * i]);
+    spots[i].exit[1] = makePath({}, exitRoutes[2 * i + 1]);
+  }
+  Logger::Info("RouteTable: {} routes, {} waypoints", spots.size() * 4, waypoints->size());
+}
+
+void RouteTable::clear() {
+  waypoints.reset();
+  spots.clear();
+  firstSpot.clear();
+  minRoadX = 0.0f;
+  maxRoadX = 100.0f;
+}
+
+const RouteTable::SpotRoutes *RouteTable::find(const Module *facility, int spotIndex) const {
+  auto it = firstSpot.find(facility);
+  if (it == firstSpot.end() || spotIndex < 0 || spotIndex >= (int)facility->getSpotCount())
+    return nullptr;
+  return &spots[it->second + spotIndex];
+}
+
+PathHandle RouteTable::makePath(std::vector<Waypoint> lead, Route route) const {
+  std::span<const Waypoint> tail(waypoints->data() + route.first, route.count);
+  return std::make_shared<const Path>(std::move(lead), tail, waypoints);
+}
+
+PathHandle RouteTable::entryPath(Vector2 from, const Module *facility, int spotIndex, Lane lane) const {
+  const SpotRoutes *routes = find(facility, spotIndex);
+  if (!routes)
+    return nullptr;
+
+  int l = static_cast<int>(lane);
+  std::vector<Waypoint> lead;
+  PathPlanner::AppendApproach(lead, from, routes->roadEntry[l]);
+  return makePath(std::move(lead), routes->entry[l]);
+}
+
+PathHandle RouteTable::exitPath(const Module *facility, int spotIndex, bool exitRight) const {
+  const SpotRoutes *routes = find(facility, spotIndex);
+  return routes ? routes->exit[exitRight ? 1 : 0] : nullptr;
+}
@@ -0,0 +1,41 @@
+#include "systems/StatisticsSystem.hpp"
+#include "config.hpp"
+
+/**
+ * @file StatisticsSystem.cpp
+ * @brief Implementation of the occupancy statistics sampler.
+ */
+
+StatisticsSystem::StatisticsSystem(std::shared_ptr<EventBus> bus, const EntityManager &entityManager)
+    : eventBus(bus), entityManager(entityManager) {}
+
+void StatisticsSystem::schedule(SystemScheduler &scheduler) {
+  scheduler.add("statistics", Config::Schedule::STATISTICS_HZ, {SimState::SPOT_STATE, 0},
+                [this](double dt) { update(dt); });
+}
+
+void StatisticsSystem::update(double /*dt*/) {
+  OccupancyStatsEvent stats;
+  for (const auto &m : entityManager.getModules()) {
+    auto type = m->getType();
+    bool isCharging = (type == ModuleType::SMALL_CHARGING || type == ModuleType::LARGE_CHARGING);
+    bool isParking = (type == ModuleType::SMALL_PARKING || type == ModuleType::LARGE_PARKING);
+    if (!isCharging && !isParking)
+      continue; // Skip roads/etc
+
+    auto counts = m->getSpotCounts();
+    int spots = counts.free + counts.reserved + counts.occupied;
+    if (isCharging) {
+      stats.chargingStations++;
+      stats.chargingSpots += spots;
+      stats.occupiedCharging += counts.occupied;
+    } else {
+      stats.parkingLots++;
+      stats.parkingSpots += spots;
+      stats.occupiedParking += counts.occupied;
+    }
+  }
+
+  latest = stats;
+  eventBus->publish(latest);
+}
@@ -2,6 +2,11 @@
 #include "events/GameEvents.hpp"
 #include "events/TrackingEvents.hpp"
 #include "core/Logger.hpp"
+#include <cmath>
+
+namespace {
+constexpr float FOLLOW_EPSILON = 0.001f; // Meters
+}
 
 // تنفيذ الـ Constructor (هذا ما يبحث عنه الـ Linker)
 TrackingSystem::TrackingSystem(std::shared_ptr<EventBus> bus) : eventBus(bus) {
@@ -23,9 +28,9 @@ TrackingSystem::TrackingSystem(std::shared_ptr<EventBus> bus) : eventBus(bus) {
         }
     }));
 
-    // التحديث الدوري
-    eventTokens.push_back(eventBus->subscribe<GameUpdateEvent>([this](const GameUpdateEvent& e) {
-        this->update(e.dt);
+    // Car storage was re-sorted: follow the car to its new address
+    eventTokens.push_back(eventBus->subscribe<CarsRelocatedEvent>([this](const CarsRelocatedEvent& e) {
+        this->targetCar = e.relocated(this->targetCar);
     }));
 }
 
@@ -36,6 +41,7 @@ void TrackingSystem::startTracking() {
     isTrackingActive = true;
     waitingForSpawn = true;
     targetCar = nullptr;
+    hasFollowed = false;
     
     // spawn a car
     eventBus->publish(SpawnCarRequestEvent{});
@@ -45,22 +51,36 @@ void TrackingSystem::startTracking() {
 void TrackingSystem::stopTracking() {
     isTrackingActive = false;
     targetCar = nullptr;
+    hasFollowed = false;
     waitingForSpawn = false;
     eventBus->publish(TrackingStatusEvent{false});
     Logger::Info("TrackingSystem: Stopped.");
 }
 
+void TrackingSystem::schedule(SystemScheduler& scheduler) {
+    // Runs before the traffic system can remove the tracked car
+    SystemScheduler::Access access{SimState::CAR_KINEMATICS | SimState::CAR_LIST, SimState::TRACKING | SimState::CAMERA};
+    scheduler.add("tracking", Config::TICK_RATE, access, [this](double dt) { this->update(dt); });
+}
+
 void TrackingSystem::update(double) {
     if (!isTrackingActive || !targetCar) return;
 
-    //get car location in meters 
-    Vector2 carPos = targetCar->getPosition();
-
-    // send car location to the camera
-    eventBus->publish(CameraMoveEvent{carPos});
-
     // end tracking if the car left
     if (targetCar->getState() == Car::CarState::EXITING && targetCar->hasArrived()) {
         stopTracking();
     }
+}
+
+void TrackingSystem::follow(float alpha) {
+    if (!isTrackingActive || !targetCar) return;
+
+    // send the car's drawn location (meters) to the camera, so it stays centred between ticks;
+    // only when it moved, as every camera move asks for a redraw
+    Vector2 position = targetCar->getRenderPosition(alpha);
+    if (hasFollowed && std::fabs(position.x - lastFollowed.x) < FOLLOW_EPSILON &&
+        std::fabs(position.y - lastFollowed.y) < FOLLOW_EPSILON) return;
+    lastFollowed = position;
+    hasFollowed = true;
+    eventBus->publish(CameraMoveEvent{position});
 }
\ No newline at end of file
@@ -16,6 +16,26 @@
 TrafficSystem::TrafficSystem(std::shared_ptr<EventBus> bus, const EntityManager &em)
     : eventBus(bus), entityManager(em) {
 
+  // A new world was installed: precompute its routes
+  eventTokens.push_back(eventBus->subscribe<WorldBoundsEvent>([this](const WorldBoundsEvent &) {
+    routes.build(entityManager.getModules());
+    flow.build(entityManager.getModules());
+    countFreeSpots();
+  }));
+
+  // Switch through-traffic between individual cars and the flow model
+  eventTokens.push_back(eventBus->subscribe<ToggleFlowModelEvent>([this](const ToggleFlowModelEvent &) {
+    mesoscopic = !mesoscopic;
+    Logger::Info("TrafficSystem: Through-traffic simulated as {}", mesoscopic ? "flow" : "cars");
+    eventBus->publish(FlowModelChangedEvent{mesoscopic});
+  }));
+
+  // Flow density over the main road lanes
+  eventTokens.push_back(eventBus->subscribe<DrawWorldEvent>([this](const DrawWorldEvent &e) {
+    if (e.drawList && !flow.isEmpty())
+      flow.draw(e.visibleArea, *e.drawList);
+  }));
+
   // Cycle Auto Spawn Level
   eventTokens.push_back(eventBus->subscribe<CycleAutoSpawnLevelEvent>([this](const CycleAutoSpawnLevelEvent &) {
     currentSpawnLevel++;
@@ -114,6 +134,9 @@ TrafficSystem::TrafficSystem(std::shared_ptr<EventBus> bus, const EntityManager
     // So it entered from LEFT.
     bool enteredFromLeft = spawnLeft;
 
+    if (divertToFlow(carType == 1, spawnLeft))
+      return;
+
     eventBus->publish(CreateCarEvent{spawnPos, spawnVel, carType, priority, enteredFromLeft});
   }));
 
@@ -271,24 +294,8 @@ TrafficSystem::TrafficSystem(std::shared_ptr<EventBus> bus, const EntityManager
     if (spotIndex == -1 || !targetFac) {
       Logger::Info("TrafficSystem: Facility full (Free: 0). Car passing through.");
 
-      // Calculate Map Bounds (Duplicated logic for now, or could act as if exiting)
-      float minRoadX = std::numeric_limits<float>::max();
-      float maxRoadX = std::numeric_limits<float>::lowest();
-      const auto &mods = entityManager.getModules();
-      for (const auto &mod : mods) {
-        if (auto *r = dynamic_cast<NormalRoad *>(mod.get())) {
-          float x = r->worldPosition.x;
-          float w = r->getWidth();
-          if (x < minRoadX)
-            minRoadX = x;
-          if (x + w > maxRoadX)
-            maxRoadX = x + w;
-        }
-      }
-      if (minRoadX == std::numeric_limits<float>::max())
-        minRoadX = 0;
-      if (maxRoadX == std::numeric_limits<float>::lowest())
-        maxRoadX = 100;
+      float minRoadX = routes.getMinRoadX();
+      float maxRoadX = routes.getMaxRoadX();
 
       // Determine direction based on velocity
       bool movingRight = e.car->getVelocity().x > 0;
@@ -297,19 +304,16 @@ TrafficSystem::TrafficSystem(std::shared_ptr<EventBus> bus, const EntityManager
       float finalX = movingRight ? (maxRoadX + 2.0f) : (minRoadX - 2.0f);
       float yPos = e.car->getPosition().y; // Maintain current lane Y
 
-      // Create direct exit path
-      std::vector<Waypoint> exitPath;
-      exitPath.push_back(Waypoint({finalX, yPos}, 1.0f, -1, 0.0f, true));
-
-      e.car->setPath(exitPath);
+      // Create direct exit path (assigned through the event, like any other path)
+      auto exitPath = std::make_shared<const Path>(std::vector<Waypoint>{Waypoint({finalX, yPos}, 1.0f, -1, 0.0f, true)});
       e.car->setState(Car::CarState::EXITING);
 
-      eventBus->publish(AssignPathEvent{e.car, exitPath});
+      eventBus->publish(AssignPathEvent{e.car, std::move(exitPath)});
       return;
     }
 
     // Reserve the spot immediately
-    targetFac->setSpotState(spotIndex, SpotState::RESERVED);
+    setSpotState(targetFac, spotIndex, SpotState::RESERVED);
 
     // Log Reservation
     auto counts = targetFac->getSpotCounts();
@@ -318,156 +322,200 @@ TrafficSystem::TrafficSystem(std::shared_ptr<EventBus> bus, const EntityManager
 
     Spot spot = targetFac->getSpot(spotIndex);
 
-    // 2. Generate Path
-    std::vector<Waypoint> path = PathPlanner::GeneratePath(e.car, targetFac, spot);
+    // 2. Look up the Path (built from scratch for facilities the table does not know)
+    PathHandle path = routes.entryPath(e.car->getPosition(), targetFac, spotIndex, PathPlanner::MainRoadLane(e.car));
+    if (!path)
+      path = std::make_shared<const Path>(PathPlanner::GeneratePath(e.car, targetFac, spot));
 
     // Store context in Car so it knows where it is when it wants to leave
     e.car->setParkingContext(targetFac, spot, spotIndex);
 
     // Publish Path Assignment
-    eventBus->publish(AssignPathEvent{e.car, path});
+    eventBus->publish(AssignPathEvent{e.car, std::move(path)});
   }));
+}
 
-  // 3. Handle Game Update
-  eventTokens.push_back(eventBus->subscribe<GameUpdateEvent>([this](const GameUpdateEvent &e) {
-    // Auto-Spawn Logic
-    if (currentSpawnLevel > 0) {
-      spawnTimer += (float)e.dt;
-      float interval = Config::Spawner::SPAWN_RATES[currentSpawnLevel];
-      if (spawnTimer >= interval) {
-        spawnTimer =
-            0.0f; // Reset or subtract? Subtract to keep cadence? Reset logic is simpler for 'interval' changes.
-        // Let's subtract to avoid drift, but since interval can change, reset might be safer if level changes.
-        // Given the requirement, simple reset is fine.
-        // Actually, if we change levels, timer should probably reset or be clamped.
-        spawnCar();
-      }
+void TrafficSystem::schedule(SystemScheduler &scheduler) {
+  using namespace SimState;
+  // Spot changes re-bake the static layer; removing a car hands its followers a new leader (lane
+  // queues); a spawned car is created, given a spot and maybe tracked
+  scheduler.add("traffic", Config::Schedule::TRAFFIC_HZ,
+                {0, CAR_KINEMATICS | CAR_LIST | SPOT_STATE | ROAD_FLOW | STATIC_LAYER},
+                [this](double dt) { update(dt); });
+  scheduler.add("spawner", Config::Schedule::SPAWNER_HZ,
+                {0, CAR_KINEMATICS | CAR_LIST | SPOT_STATE | ROAD_FLOW | STATIC_LAYER | TRACKING},
+                [this](double dt) { updateSpawner(dt); });
+  scheduler.add("parking", Config::Schedule::PARKING_HZ, {0, CAR_KINEMATICS | SPOT_STATE | STATIC_LAYER},
+                [this](double dt) { updateParking(dt); });
+}
+
+void TrafficSystem::updateSpawner(double dt) {
+  // Auto-Spawn Logic
+  if (currentSpawnLevel > 0) {
+    spawnTimer += (float)dt;
+    float interval = Config::Spawner::SPAWN_RATES[currentSpawnLevel];
+    if (spawnTimer >= interval) {
+      spawnTimer = 0.0f; // Reset rather than subtract: the interval changes with the level
+      spawnCar();
     }
+  }
+
+  // Mesoscopic through-traffic: background demand on top of the diverted spawns
+  if (mesoscopic && currentSpawnLevel > 0) {
+    float arrivals = Config::Flow::BACKGROUND_DEMAND[currentSpawnLevel] / 3600.0f * (float)dt;
+    flow.addVehicles(true, arrivals / 2.0f);
+    flow.addVehicles(false, arrivals / 2.0f);
+  }
+}
 
-    // We use getCars() directly
-    const auto &cars = entityManager.getCars();
+void TrafficSystem::update(double dt) {
+  if (!flow.isEmpty()) {
+    flow.step((float)dt);
+  }
 
-    // List of cars to remove (pointers)
-    std::vector<Car *> carsToRemove;
+  // We use getCars() directly
+  const auto &cars = entityManager.getCars();
 
-    // Calculate World Road Boundaries
-    float minRoadX = std::numeric_limits<float>::max();
-    float maxRoadX = std::numeric_limits<float>::lowest();
+  // List of cars to remove (pointers)
+  std::vector<Car *> carsToRemove;
 
-    const auto &modules = entityManager.getModules();
-    for (const auto &mod : modules) {
-      if (auto *r = dynamic_cast<NormalRoad *>(mod.get())) {
-        float x = r->worldPosition.x;
-        float w = r->getWidth();
-        if (x < minRoadX)
-          minRoadX = x;
-        if (x + w > maxRoadX)
-          maxRoadX = x + w;
-      }
-    }
+  for (const auto &carPtr : cars) {
+    Car *car = carPtr.get();
+    if (!car)
+      continue;
 
-    if (minRoadX == std::numeric_limits<float>::max())
-      minRoadX = 0;
-    if (maxRoadX == std::numeric_limits<float>::lowest())
-      maxRoadX = 100;
-
-    for (const auto &carPtr : cars) {
-      Car *car = carPtr.get();
-      if (!car)
-        continue;
-
-      // Check for Arrival (Transition RESERVED -> OCCUPIED)
-      if (car->getState() == Car::CarState::ALIGNING || car->getState() == Car::CarState::PARKED) {
-        Module *fac = const_cast<Module *>(car->getParkedFacility());
-        int idx = car->getParkedSpotIndex();
-        if (fac && idx != -1) {
-          Spot s = fac->getSpot(idx);
-          if (s.state == SpotState::RESERVED) {
-            fac->setSpotState(idx, SpotState::OCCUPIED);
-            // auto counts = fac->getSpotCounts();
-            // Logger::Info("TrafficSystem: Spot Occupied.");
-          }
+    // Check for Arrival (Transition RESERVED -> OCCUPIED)
+    if (car->getState() == Car::CarState::ALIGNING || car->getState() == Car::CarState::PARKED) {
+      Module *fac = const_cast<Module *>(car->getParkedFacility());
+      int idx = car->getParkedSpotIndex();
+      if (fac && idx != -1) {
+        Spot s = fac->getSpot(idx);
+        if (s.state == SpotState::RESERVED) {
+          setSpotState(fac, idx, SpotState::OCCUPIED);
         }
       }
+    }
 
-      // Handle Parked Logic (Charging vs Waiting)
-      bool shouldExit = false;
+    // Check if finished exiting
+    if (car->getState() == Car::CarState::EXITING && car->hasArrived()) {
+      carsToRemove.push_back(car);
+    }
+  }
 
-      if (car->getState() == Car::CarState::PARKED) {
-        Module *fac = const_cast<Module *>(car->getParkedFacility());
+  for (Car *c : carsToRemove) {
+    const_cast<EntityManager &>(entityManager).removeCar(c);
+  }
+}
 
-        bool isChargingSpot = false;
-        if (dynamic_cast<SmallChargingStation *>(fac) || dynamic_cast<LargeChargingStation *>(fac)) {
-          isChargingSpot = true;
-        }
+void TrafficSystem::updateParking(double dt) {
+  // World Road Boundaries
+  float minRoadX = routes.getMinRoadX();
+  float maxRoadX = routes.getMaxRoadX();
 
-        if (isChargingSpot && car->getType() == Car::CarType::ELECTRIC) {
-          car->charge(Config::CHARGING_RATE * (float)e.dt);
-          float bat = car->getBatteryLevel();
-
-          if (bat > Config::BATTERY_FORCE_EXIT_THRESHOLD) {
-            shouldExit = true;
-          } else if (bat > Config::BATTERY_EXIT_THRESHOLD) {
-            float range = Config::BATTERY_FORCE_EXIT_THRESHOLD - Config::BATTERY_EXIT_THRESHOLD;
-            float excess = bat - Config::BATTERY_EXIT_THRESHOLD;
-            float probability = 0.5f * (excess / range) * (float)e.dt;
-            if ((float)GetRandomValue(0, 10000) / 10000.0f < probability) {
-              shouldExit = true;
-            }
-          }
-        } else {
-          if (car->isReadyToLeave()) {
-            shouldExit = true;
-          }
-        }
-      }
+  for (const auto &carPtr : entityManager.getCars()) {
+    Car *car = carPtr.get();
+    if (!car || car->getState() != Car::CarState::PARKED)
+      continue;
 
-      // Check if ready to leave parking
-      if (shouldExit) {
-        // ... (Existing Exit Logic) ...
-        Logger::Info("TrafficSystem: Car exiting.");
+    // Handle Parked Logic (Charging vs Waiting)
+    bool shouldExit = false;
+    Module *fac = const_cast<Module *>(car->getParkedFacility());
 
-        Module *currentFac = const_cast<Module *>(car->getParkedFacility());
-        Spot currentSpot = car->getParkedSpot();
-        int idx = car->getParkedSpotIndex();
+    bool isChargingSpot = false;
+    if (dynamic_cast<SmallChargingStation *>(fac) || dynamic_cast<LargeChargingStation *>(fac)) {
+      isChargingSpot = true;
+    }
 
-        if (!currentFac) {
-          car->setState(Car::CarState::DRIVING);
-          continue;
+    if (isChargingSpot && car->getType() == Car::CarType::ELECTRIC) {
+      car->charge(Config::CHARGING_RATE * (float)dt);
+      float bat = car->getBatteryLevel();
+
+      if (bat > Config::BATTERY_FORCE_EXIT_THRESHOLD) {
+        shouldExit = true;
+      } else if (bat > Config::BATTERY_EXIT_THRESHOLD) {
+        // Exit rate per second; dt is the whole interval since the last decision
+        float range = Config::BATTERY_FORCE_EXIT_THRESHOLD - Config::BATTERY_EXIT_THRESHOLD;
+        float excess = bat - Config::BATTERY_EXIT_THRESHOLD;
+        float probability = 0.5f * (excess / range) * (float)dt;
+        if ((float)GetRandomValue(0, 10000) / 10000.0f < probability) {
+          shouldExit = true;
         }
+      }
+    } else {
+      car->countDownParking((float)dt);
+      if (car->isReadyToLeave()) {
+        shouldExit = true;
+      }
+    }
 
-        if (idx != -1) {
-          currentFac->setSpotState(idx, SpotState::FREE);
-        }
+    if (!shouldExit)
+      continue;
 
-        bool exitRight = false;
-        if (car->getPriority() == Car::Priority::PRIORITY_DISTANCE) {
-          exitRight = !car->getEnteredFromLeft();
-        } else {
-          exitRight = (GetRandomValue(0, 1) == 1);
-        }
+    Logger::Info("TrafficSystem: Car exiting.");
 
-        float finalX = exitRight ? (maxRoadX + 2.0f) : (minRoadX - 2.0f);
-        std::vector<Waypoint> path = PathPlanner::GenerateExitPath(car, currentFac, currentSpot, exitRight, finalX);
+    Spot currentSpot = car->getParkedSpot();
+    int idx = car->getParkedSpotIndex();
 
-        car->setPath(path);
-        car->setState(Car::CarState::EXITING);
-      }
+    if (!fac) {
+      car->setState(Car::CarState::DRIVING);
+      continue;
+    }
 
-      // Check if finished exiting
-      if (car->getState() == Car::CarState::EXITING && car->hasArrived()) {
-        carsToRemove.push_back(car);
-      }
+    if (idx != -1) {
+      setSpotState(fac, idx, SpotState::FREE);
     }
 
-    for (Car *c : carsToRemove) {
-      const_cast<EntityManager &>(entityManager).removeCar(c);
+    bool exitRight = false;
+    if (car->getPriority() == Car::Priority::PRIORITY_DISTANCE) {
+      exitRight = !car->getEnteredFromLeft();
+    } else {
+      exitRight = (GetRandomValue(0, 1) == 1);
     }
-  }));
+
+    PathHandle path = routes.exitPath(fac, idx, exitRight);
+    if (!path) {
+      float finalX = exitRight ? (maxRoadX + 2.0f) : (minRoadX - 2.0f);
+      path = std::make_shared<const Path>(PathPlanner::GenerateExitPath(car, fac, currentSpot, exitRight, finalX));
+    }
+
+    car->setPath(std::move(path));
+    car->setState(Car::CarState::EXITING);
+  }
 }
 
 TrafficSystem::~TrafficSystem() { eventTokens.clear(); }
 
+void TrafficSystem::countFreeSpots() {
+  freeParkingSpots = 0;
+  freeChargingSpots = 0;
+  for (const auto &mod : entityManager.getModules()) {
+    if (int *counter = freeSpotCounter(*mod))
+      *counter += mod->getSpotCounts().free;
+  }
+}
+
+int *TrafficSystem::freeSpotCounter(const Module &facility) {
+  switch (facility.getType()) {
+  case ModuleType::SMALL_PARKING:
+  case ModuleType::LARGE_PARKING:
+    return &freeParkingSpots;
+  case ModuleType::SMALL_CHARGING:
+  case ModuleType::LARGE_CHARGING:
+    return &freeChargingSpots;
+  default:
+    return nullptr;
+  }
+}
+
+void TrafficSystem::setSpotState(Module *facility, int spotIndex, SpotState state) {
+  // Every spot change goes through here, which keeps the free-spot totals current
+  bool wasFree = facility->getSpot(spotIndex).state == SpotState::FREE;
+  if (int *counter = freeSpotCounter(*facility))
+    *counter += (state == SpotState::FREE ? 1 : 0) - (wasFree ? 1 : 0);
+  facility->setSpotState(spotIndex, state);
+  eventBus->publish(SpotStateChangedEvent{facility, spotIndex});
+}
+
 void TrafficSystem::spawnCar() {
   Logger::Info("TrafficSystem: Processing Spawn Logic...");
 
@@ -528,5 +576,20 @@ void TrafficSystem::spawnCar() {
   int priority = (GetRandomValue(0, 1) == 0) ? 0 : 1;
   bool enteredFromLeft = spawnLeft;
 
+  if (divertToFlow(carType == 1, spawnLeft))
+    return;
+
   eventBus->publish(CreateCarEvent{spawnPos, spawnVel, carType, priority, enteredFromLeft});
 }
+
+bool TrafficSystem::divertToFlow(bool electric, bool towardsRight) {
+  if (!mesoscopic || !flow.isBuilt())
+    return false;
+
+  // Anywhere left to park? Then the car turns off the road and is simulated individually
+  if (freeParkingSpots > 0 || (electric && freeChargingSpots > 0))
+    return false;
+
+  flow.addVehicles(towardsRight);
+  return true;
+}
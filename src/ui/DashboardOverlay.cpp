@@ -2,6 +2,7 @@
 #include "config.hpp"
 #include "events/InputEvents.hpp"
 #include "raymath.h"
+#include <cmath>
 #include <format>
 #include <string>
 
@@ -18,6 +19,16 @@ DashboardOverlay::DashboardOverlay(std::shared_ptr<EventBus> bus, EntityManager
     }
   }));
 
+  // The selected car moved to a new address when car storage was re-sorted
+  eventTokens.push_back(bus->subscribe<CarsRelocatedEvent>(
+      [this](const CarsRelocatedEvent &e) { currentSelection.car = e.relocated(currentSelection.car); }));
+
+  // General info shows the latest occupancy sample
+  eventTokens.push_back(bus->subscribe<OccupancyStatsEvent>([this](const OccupancyStatsEvent &e) {
+    occupancy = e;
+    occupancySample++;
+  }));
+
   // Subscribe to Toggle Event
   eventTokens.push_back(
       bus->subscribe<ToggleDashboardEvent>([this](const ToggleDashboardEvent &) { visible = !visible; }));
@@ -29,6 +40,18 @@ DashboardOverlay::DashboardOverlay(std::shared_ptr<EventBus> bus, EntityManager
     }
   }));
 
+  // Re-render the cached panel when anything it shows has changed
+  eventTokens.push_back(bus->subscribe<PreRenderEvent>([this](const PreRenderEvent &) {
+    if (!visible)
+      return;
+    ContentKey key = currentKey();
+    if (key != cachedKey) {
+      cachedKey = key;
+      cache.invalidate();
+    }
+    cache.refresh(panelArea(), [this](DrawList &out) { recordPanel(out); });
+  }));
+
   // Default to general info
   currentSelection.type = SelectionType::GENERAL;
 }
@@ -41,10 +64,38 @@ void DashboardOverlay::update(double /*dt*/) {
   // No specific update logic needed for now
 }
 
-void DashboardOverlay::draw() {
+void DashboardOverlay::draw(DrawList &out) {
   if (!visible)
     return;
 
+  // Values may have changed since the last refresh (e.g. during this frame's ticks)
+  if (cache.isReady() && currentKey() == cachedKey) {
+    cache.draw(out);
+  } else {
+    recordPanel(out);
+  }
+}
+
+DashboardOverlay::ContentKey DashboardOverlay::currentKey() const {
+  ContentKey key;
+  key.type = currentSelection.type;
+  key.spotIndex = currentSelection.spotIndex;
+  key.statsVersion = entityManager ? entityManager->getStatsVersion() : 0;
+  key.occupancySample = occupancySample;
+
+  if (currentSelection.type == SelectionType::CAR && currentSelection.car) {
+    const Car *car = currentSelection.car;
+    key.subject = car;
+    key.carState = (int)car->getState();
+    key.speedTenths = std::lround(Vector2Length(car->getVelocity()) * 10.0f);
+    key.batteryTenths = std::lround(car->getBatteryLevel() * 10.0f);
+  } else if (currentSelection.type == SelectionType::FACILITY || currentSelection.type == SelectionType::SPOT) {
+    key.subject = currentSelection.module;
+  }
+  return key;
+}
+
+Rectangle DashboardOverlay::panelArea() const {
   int screenWidth = Config::LOGICAL_WIDTH;
   int panelWidth = 300;
   int pad = 20;
@@ -72,112 +123,79 @@ void DashboardOverlay::draw() {
   // Add padding
   estimatedHeight += 30;
 
+  return {(float)x, (float)y, (float)panelWidth, (float)estimatedHeight};
+}
+
+void DashboardOverlay::recordPanel(DrawList &out) {
   // Draw Background
-  DrawRectangle(x, y, panelWidth, estimatedHeight, Fade(BLACK, 0.8f));
-  DrawRectangleLines(x, y, panelWidth, estimatedHeight, DARKGRAY);
+  Rectangle panel = panelArea();
+  out.rect(DrawLayer::UI, panel, Fade(BLACK, 0.8f));
+  out.rectLines(DrawLayer::UI, panel, 1.0f, DARKGRAY);
 
-  int contentX = x + 15;
-  int contentY = y + 15;
-  int contentWidth = panelWidth - 30;
+  int contentX = (int)panel.x + 15;
+  int contentY = (int)panel.y + 15;
+  int contentWidth = (int)panel.width - 30;
 
   switch (currentSelection.type) {
   case SelectionType::CAR:
-    drawCarInfo(contentX, contentY, contentWidth);
+    drawCarInfo(out, contentX, contentY, contentWidth);
     break;
   case SelectionType::FACILITY:
-    drawFacilityInfo(contentX, contentY, contentWidth);
+    drawFacilityInfo(out, contentX, contentY, contentWidth);
     break;
   case SelectionType::SPOT:
-    drawSpotInfo(contentX, contentY, contentWidth);
+    drawSpotInfo(out, contentX, contentY, contentWidth);
     break;
   case SelectionType::GENERAL:
   default:
-    drawGeneralInfo(contentX, contentY, contentWidth);
+    drawGeneralInfo(out, contentX, contentY, contentWidth);
     break;
   }
 }
 
-void DashboardOverlay::drawGeneralInfo(int x, int y, int width) {
-  DrawText("GENERAL INFO", x, y, 20, GOLD);
+void DashboardOverlay::drawGeneralInfo(DrawList &out, int x, int y, int width) {
+  out.text(DrawLayer::UI, "GENERAL INFO", {(float)x, (float)y}, 20, GOLD);
   y += 30;
 
-  int totalFacilities = 0;
-  int totalSpots = 0;
-  int occupiedSpots = 0;
-
-  int chargingStations = 0;
-  int parkingLots = 0;
-
-  int chargingSpots = 0;
-  int occupiedCharging = 0;
-
-  int parkingSpots = 0;
-  int occupiedParking = 0;
-
-  if (entityManager) {
-    auto &modules = entityManager->getModules();
-    // totalFacilities = modules.size(); // Incorrect, includes roads
-
-    for (const auto &m : modules) {
-      auto type = m->getType();
-      bool isCharging = (type == ModuleType::SMALL_CHARGING || type == ModuleType::LARGE_CHARGING);
-      bool isParking = (type == ModuleType::SMALL_PARKING || type == ModuleType::LARGE_PARKING);
-
-      if (!isCharging && !isParking)
-        continue; // Skip roads/etc
-
-      totalFacilities++;
-
-      auto counts = m->getSpotCounts();
-      totalSpots += (counts.free + counts.reserved + counts.occupied);
-      occupiedSpots += counts.occupied;
-
-      if (isCharging) {
-        chargingStations++;
-        chargingSpots += (counts.free + counts.reserved + counts.occupied);
-        occupiedCharging += counts.occupied;
-      } else if (isParking) {
-        parkingLots++;
-        parkingSpots += (counts.free + counts.reserved + counts.occupied);
-        occupiedParking += counts.occupied;
-      }
-    }
-  }
+  // Last sample from the StatisticsSystem
+  const OccupancyStatsEvent &stats = occupancy;
+  int totalSpots = stats.parkingSpots + stats.chargingSpots;
+  int occupiedSpots = stats.occupiedParking + stats.occupiedCharging;
 
   auto drawStat = [&](const char *label, const std::string &val) {
-    DrawText(label, x, y, 20, WHITE);
-    DrawText(val.c_str(), x + width - MeasureText(val.c_str(), 20), y, 20, GREEN);
+    out.text(DrawLayer::UI, label, {(float)x, (float)y}, 20, WHITE);
+    out.text(DrawLayer::UI, val, {(float)(x + width - MeasureText(val.c_str(), 20)), (float)y}, 20, GREEN);
     y += 25;
   };
 
-  drawStat("Facilities:", std::format("{}", totalFacilities));
-  drawStat("Pk Lots:", std::format("{}", parkingLots));
-  drawStat("Chrg Stns:", std::format("{}", chargingStations));
+  drawStat("Facilities:", std::format("{}", stats.parkingLots + stats.chargingStations));
+  drawStat("Pk Lots:", std::format("{}", stats.parkingLots));
+  drawStat("Chrg Stns:", std::format("{}", stats.chargingStations));
 
   y += 10;
-  DrawText("OCCUPANCY", x, y, 20, YELLOW);
+  out.text(DrawLayer::UI, "OCCUPANCY", {(float)x, (float)y}, 20, YELLOW);
   y += 25;
 
   float overallOcc = totalSpots > 0 ? (float)occupiedSpots / totalSpots * 100.0f : 0.0f;
-  float parkingOcc = parkingSpots > 0 ? (float)occupiedParking / parkingSpots * 100.0f : 0.0f;
-  float chargingOcc = chargingSpots > 0 ? (float)occupiedCharging / chargingSpots * 100.0f : 0.0f;
+  float parkingOcc = stats.parkingSpots > 0 ? (float)stats.occupiedParking / stats.parkingSpots * 100.0f : 0.0f;
+  float chargingOcc = stats.chargingSpots > 0 ? (float)stats.occupiedCharging / stats.chargingSpots * 100.0f : 0.0f;
 
   drawStat("Overall:", std::format("{:.1f}%", overallOcc));
   drawStat("Parking:", std::format("{:.1f}%", parkingOcc));
   drawStat("Charging:", std::format("{:.1f}%", chargingOcc));
 }
 
-void DashboardOverlay::drawCarInfo(int x, int y, int width) {
+void DashboardOverlay::drawCarInfo(DrawList &out, int x, int y, int width) {
   if (!currentSelection.car)
     return;
   auto *car = currentSelection.car;
 
-  DrawText("CAR INFO", x, y, 20, GOLD);
+  out.text(DrawLayer::UI, "CAR INFO", {(float)x, (float)y}, 20, GOLD);
   y += 30;
 
   auto drawStat = [&](const char *label, const std::string &val) {
-    DrawText(label, x, y, 20, WHITE);
-    DrawText(val.c_str(), x + width - MeasureText(val.c_str(), 20), y, 20, GREEN);
+    out.text(DrawLayer::UI, label, {(float)x, (float)y}, 20, WHITE);
+    out.text(DrawLayer::UI, val, {(float)(x + width - MeasureText(val.c_str(), 20)), (float)y}, 20, GREEN);
     y += 25;
   };
 
@@ -211,17 +229,17 @@ void DashboardOverlay::drawCarInfo(int x, int y, int width) {
   drawStat("Priority:", (car->getPriority() == Car::Priority::PRIORITY_PRICE) ? "Price" : "Distance");
 }
 
-void DashboardOverlay::drawFacilityInfo(int x, int y, int width) {
+void DashboardOverlay::drawFacilityInfo(DrawList &out, int x, int y, int width) {
   if (!currentSelection.module)
     return;
   auto *m = currentSelection.module;
 
-  DrawText("FACILITY INFO", x, y, 20, GOLD);
+  out.text(DrawLayer::UI, "FACILITY INFO", {(float)x, (float)y}, 20, GOLD);
   y += 30;
 
   auto drawStat = [&](const char *label, const std::string &val) {
-    DrawText(label, x, y, 20, WHITE);
-    DrawText(val.c_str(), x + width - MeasureText(val.c_str(), 20), y, 20, GREEN);
+    out.text(DrawLayer::UI, label, {(float)x, (float)y}, 20, WHITE);
+    out.text(DrawLayer::UI, val, {(float)(x + width - MeasureText(val.c_str(), 20)), (float)y}, 20, GREEN);
     y += 25;
   };
 
@@ -258,18 +276,18 @@ void DashboardOverlay::drawFacilityInfo(int x, int y, int width) {
   drawStat("Price Mult:", std::format("{:.2f}x", m->getPriceMultiplier()));
 }
 
-void DashboardOverlay::drawSpotInfo(int x, int y, int width) {
+void DashboardOverlay::drawSpotInfo(DrawList &out, int x, int y, int width) {
   if (!currentSelection.module || currentSelection.spotIndex == -1)
     return;
   auto *m = currentSelection.module;
   Spot spot = m->getSpot(currentSelection.spotIndex);
 
-  DrawText("SPOT INFO", x, y, 20, GOLD);
+  out.text(DrawLayer::UI, "SPOT INFO", {(float)x, (float)y}, 20, GOLD);
   y += 30;
 
   auto drawStat = [&](const char *label, const std::string &val) {
-    DrawText(label, x, y, 20, WHITE);
-    DrawText(val.c_str(), x + width - MeasureText(val.c_str(), 20), y, 20, GREEN);
+    out.text(DrawLayer::UI, label, {(float)x, (float)y}, 20, WHITE);
+    out.text(DrawLayer::UI, val, {(float)(x + width - MeasureText(val.c_str(), 20)), (float)y}, 20, GREEN);
     y += 25;
   };
 
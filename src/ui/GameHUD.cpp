@@ -12,6 +12,17 @@
  * @brief Implementation of GameHUD.
  */
 
+static constexpr const char *HINT_TEXT = "WASD: Move | Scroll: Zoom | ESC: Menu";
+static constexpr const char *PAUSED_TEXT = "PAUSED";
+
+static void recordHint(DrawList &out) {
+  out.text(DrawLayer::UI, HINT_TEXT, {10, Config::LOGICAL_HEIGHT - 30.0f}, 20, DARKGRAY);
+}
+
+static void recordPaused(DrawList &out) {
+  out.text(DrawLayer::UI, PAUSED_TEXT, {Config::LOGICAL_WIDTH / 2.0f - 100, 50}, 60, MAROON);
+}
+
 GameHUD::GameHUD(std::shared_ptr<EventBus> bus, EntityManager *entityManager) : eventBus(bus) {
   // Setup UI Elements
   uiManager.add(std::make_shared<DashboardOverlay>(eventBus, entityManager));
@@ -42,6 +53,18 @@ GameHUD::GameHUD(std::shared_ptr<EventBus> bus, EntityManager *entityManager) :
   autoSpawnBtn->setOnClick([this]() { eventBus->publish(CycleAutoSpawnLevelEvent{}); });
   uiManager.add(autoSpawnBtn);
 
+  // Through-traffic model toggle (individual cars or mesoscopic flow)
+  auto flowBtn = std::make_shared<UIButton>(Vector2{10, 210}, Vector2{150, 40}, "Flow: Cars", eventBus);
+  flowBtn->setOnClick([this]() { eventBus->publish(ToggleFlowModelEvent{}); });
+  uiManager.add(flowBtn);
+
+  std::weak_ptr<UIButton> weakFlowBtn = flowBtn;
+  eventTokens.push_back(eventBus->subscribe<FlowModelChangedEvent>([weakFlowBtn](const FlowModelChangedEvent &e) {
+    if (auto btn = weakFlowBtn.lock()) {
+      btn->setText(e.mesoscopic ? "Flow: Meso" : "Flow: Cars");
+    }
+  }));
+
   //------------------------------------------------
   // definition de traking button
   // تعريف زر واحد ذكي
@@ -75,6 +98,15 @@ GameHUD::GameHUD(std::shared_ptr<EventBus> bus, EntityManager *entityManager) :
         autoSpawnBtn->setText(text);
       }));
 
+  // Rasterise the static HUD text (no-op once cached)
+  eventTokens.push_back(eventBus->subscribe<PreRenderEvent>([this](const PreRenderEvent &) {
+    hintCache.refresh({10, Config::LOGICAL_HEIGHT - 30.0f, (float)MeasureText(HINT_TEXT, 20), 20}, recordHint);
+    if (isPaused) {
+      pausedCache.refresh({Config::LOGICAL_WIDTH / 2.0f - 100, 50, (float)MeasureText(PAUSED_TEXT, 60), 60},
+                          recordPaused);
+    }
+  }));
+
   // Subscribe to Pause Events to toggle pause text visibility
   eventTokens.push_back(eventBus->subscribe<GamePausedEvent>([this](const GamePausedEvent &) { isPaused = true; }));
 
@@ -85,13 +117,19 @@ GameHUD::~GameHUD() { eventTokens.clear(); }
 
 void GameHUD::update(double dt) { uiManager.update(dt); }
 
-void GameHUD::draw() {
-  uiManager.draw();
+void GameHUD::draw(DrawList &out) {
+  uiManager.draw(out);
 
-  // Draw Static HUD Text
+  // Draw Static HUD Text (recorded directly until the caches are filled)
   if (isPaused) {
-    DrawText("PAUSED", Config::LOGICAL_WIDTH / 2 - 100, 50, 60, MAROON);
+    if (pausedCache.isReady())
+      pausedCache.draw(out);
+    else
+      recordPaused(out);
   }
 
-  DrawText("WASD: Move | Scroll: Zoom | ESC: Menu", 10, Config::LOGICAL_HEIGHT - 30, 20, DARKGRAY);
+  if (hintCache.isReady())
+    hintCache.draw(out);
+  else
+    recordHint(out);
 }
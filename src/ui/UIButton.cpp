@@ -1,10 +1,8 @@
 #include "ui/UIButton.hpp"
+#include "events/GameEvents.hpp"
 #include "events/InputEvents.hpp"
 #include "raylib.h"
 
-static Sound clickSound;
-static bool clickSoundLoaded = false;
-
 /**
  * @file UIButton.cpp
  * @brief Implementation of a clickable UI button.
@@ -13,21 +11,17 @@ static bool clickSoundLoaded = false;
 UIButton::UIButton(Vector2 pos, Vector2 sz, const std::string &buttonText, std::shared_ptr<EventBus> bus)
     : UIElement(pos, sz, bus), text(buttonText) {
 
-  if (!clickSoundLoaded) {
-    // Load in mp3 format
-    clickSound = LoadSound("assets/click_sound.mp3");
-
-    if (clickSound.frameCount > 0) {
-      SetSoundVolume(clickSound, 1.0f);
-      clickSoundLoaded = true;
-      TraceLog(LOG_INFO, "Click sound (mp3) loaded successfully!");
-    } else {
-      // Attempt to load from an alternative path if the first fails
-      clickSound = LoadSound("../assets/click_sound.mp3");
-      if (clickSound.frameCount > 0)
-        clickSoundLoaded = true;
+  // Re-render the cached button only when its look changed
+  tokens.push_back(eventBus->subscribe<PreRenderEvent>([this](const PreRenderEvent &) {
+    if (!visible)
+      return;
+    if (isHovered != cachedHovered || isPressed != cachedPressed) {
+      cache.invalidate();
     }
-  }
+    cache.refresh({position.x, position.y, size.x, size.y}, [this](DrawList &out) { recordContent(out); });
+    cachedHovered = isHovered;
+    cachedPressed = isPressed;
+  }));
 
   // 1. Subscribe to Mouse Move (Keep token!)
   // Updates hover state based on mouse position
@@ -49,12 +43,8 @@ UIButton::UIButton(Vector2 pos, Vector2 sz, const std::string &buttonText, std::
       if (e.down) {
         isPressed = true;
       } else if (isPressed) {
-        // --- Major logic update here ---
-        if (clickSoundLoaded) {
-          SetSoundVolume(clickSound, 0.3f); // Ensure the sound is at maximum level
-          StopSound(clickSound);            // Stop any previous button sound (to avoid overlap)
-          PlaySound(clickSound);            // Play sound immediately
-        }
+        // Played by the AudioSystem on its own thread
+        eventBus->publish(PlaySoundEvent{SoundEffect::CLICK});
 
         if (onClick)
           onClick();
@@ -66,10 +56,18 @@ UIButton::UIButton(Vector2 pos, Vector2 sz, const std::string &buttonText, std::
   }));
 }
 
-void UIButton::draw() {
+void UIButton::draw(DrawList &out) {
   if (!visible)
     return;
 
+  if (cache.isReady() && isHovered == cachedHovered && isPressed == cachedPressed) {
+    cache.draw(out);
+  } else {
+    recordContent(out);
+  }
+}
+
+void UIButton::recordContent(DrawList &out) const {
   // 1. Define neon colors (blue and purple)
   Color baseColor = {30, 30, 70, 180};   // Transparent dark blue for the background
   Color hoverColor = {140, 0, 255, 230}; // Neon purple on mouse hover
@@ -79,7 +77,7 @@ void UIButton::draw() {
   Color currentC = isPressed ? pressColor : (isHovered ? hoverColor : baseColor);
 
   // 2. Draw button body (using provided position and size)
-  DrawRectangleV(position, size, currentC);
+  out.rect(DrawLayer::UI, {position.x, position.y, size.x, size.y}, currentC);
 
   // 3. Draw glowing neon border
   float lineThickness = isHovered ? 3.0f : 1.5f;
@@ -87,15 +85,21 @@ void UIButton::draw() {
   Color borderColor = isHovered ? Color{0, 255, 255, 255} : Color{100, 100, 200, 255};
 
   Rectangle btnRect = {position.x, position.y, size.x, size.y};
-  DrawRectangleLinesEx(btnRect, lineThickness, borderColor);
+  out.rectLines(DrawLayer::UI, btnRect, lineThickness, borderColor);
 
   // 4. Draw text in white for clarity
   int fSize = 22;
   int txtW = MeasureText(this->text.c_str(), fSize);
 
-  DrawText(this->text.c_str(), (int)(position.x + (size.x - txtW) / 2), (int)(position.y + (size.y - fSize) / 2), fSize,
-           WHITE);
+  int textX = (int)(position.x + (size.x - txtW) / 2);
+  int textY = (int)(position.y + (size.y - fSize) / 2);
+  out.text(DrawLayer::UI, this->text, {(float)textX, (float)textY}, fSize, WHITE);
+}
+void UIButton::setText(const std::string &t) {
+  if (t != this->text) {
+    this->text = t;
+    cache.invalidate();
+  }
 }
-void UIButton::setText(const std::string &t) { this->text = t; }
 void UIButton::setOnClick(std::function<void()> cb) { onClick = cb; }
 void UIButton::update(double) {}
@@ -0,0 +1,58 @@
+#include "ui/UICache.hpp"
+#include "rlgl.h"
+#include <algorithm>
+#include <cmath>
+
+/**
+ * @file UICache.cpp
+ * @brief Implementation of the render-texture UI cache.
+ */
+
+UICache::~UICache() {
+  if (target.id != 0) {
+    UnloadRenderTexture(target);
+  }
+}
+
+void UICache::refresh(Rectangle newArea, const RecordFn &record) {
+  if (!dirty)
+    return;
+
+  int w = std::max(1, (int)std::ceil(newArea.width));
+  int h = std::max(1, (int)std::ceil(newArea.height));
+
+  // Grow only: panels whose height varies keep one texture and use its top-left part
+  if (target.id == 0 || target.texture.width < w || target.texture.height < h) {
+    int texW = std::max(w, target.texture.width);
+    int texH = std::max(h, target.texture.height);
+    if (target.id != 0) {
+      UnloadRenderTexture(target);
+    }
+    target = LoadRenderTexture(texW, texH);
+  }
+  area = {newArea.x, newArea.y, (float)w, (float)h};
+
+  list.clear();
+  record(list);
+
+  // Colour blended as usual, alpha accumulated: leaves premultiplied colour over a blank target
+  rlSetBlendFactorsSeparate(RL_SRC_ALPHA, RL_ONE_MINUS_SRC_ALPHA, RL_ONE, RL_ONE_MINUS_SRC_ALPHA, RL_FUNC_ADD,
+                            RL_FUNC_ADD);
+
+  BeginTextureMode(target);
+  ClearBackground(BLANK);
+  BeginMode2D({{0, 0}, {area.x, area.y}, 0.0f, 1.0f});
+  BeginBlendMode(BLEND_CUSTOM_SEPARATE);
+  list.submit();
+  EndBlendMode();
+  EndMode2D();
+  EndTextureMode();
+
+  dirty = false;
+}
+
+void UICache::draw(DrawList &out) const {
+  // Render textures are stored upside down: flip the source rectangle
+  Rectangle source = {0, (float)target.texture.height - area.height, area.width, -area.height};
+  out.premultipliedSprite(DrawLayer::UI, target.texture, source, area);
+}
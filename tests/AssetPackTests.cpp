@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+#include "core/AssetPack.hpp"
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+class AssetPackTests : public ::testing::Test {
+protected:
+    std::string file = (std::filesystem::temp_directory_path() / "parklogic_test.pack").string();
+
+    void TearDown() override { std::remove(file.c_str()); }
+};
+
+TEST_F(AssetPackTests, RoundTripsImages) {
+    std::vector<unsigned char> small(2 * 3 * 4);
+    std::vector<unsigned char> large(5 * 7 * 4);
+    for (std::size_t i = 0; i < small.size(); ++i) small[i] = (unsigned char)i;
+    for (std::size_t i = 0; i < large.size(); ++i) large[i] = (unsigned char)(255 - i);
+
+    const AssetPack::Source sources[] = {
+        {"assets/small.png", 2, 3, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, small},
+        {"assets/large.png", 5, 7, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, large},
+    };
+    ASSERT_TRUE(AssetPack::Write(file, sources));
+
+    AssetPack pack;
+    ASSERT_TRUE(pack.open(file));
+    EXPECT_EQ(pack.getEntryCount(), 2u);
+    EXPECT_EQ(pack.find("assets/missing.png"), nullptr);
+
+    const AssetPackEntry *entry = pack.find("assets/large.png");
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->width, 5u);
+    EXPECT_EQ(entry->height, 7u);
+    EXPECT_EQ(entry->offset % 16, 0u);
+
+    auto texels = pack.texels(*entry);
+    ASSERT_EQ(texels.size(), large.size());
+    EXPECT_TRUE(std::equal(texels.begin(), texels.end(), large.begin()));
+
+    Image image = pack.image(*pack.find("assets/small.png"));
+    EXPECT_EQ(image.width, 2);
+    EXPECT_EQ(image.format, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    EXPECT_EQ(static_cast<unsigned char *>(image.data)[5], 5);
+}
+
+TEST_F(AssetPackTests, RejectsMissingOrForeignFiles) {
+    AssetPack pack;
+    EXPECT_FALSE(pack.open(file));
+
+    std::ofstream(file, std::ios::binary) << "this is not an asset pack at all";
+    EXPECT_FALSE(pack.open(file));
+    EXPECT_FALSE(pack.isOpen());
+}
+
+TEST_F(AssetPackTests, RejectsTruncatedPack) {
+    std::vector<unsigned char> texels(64 * 64 * 4, 1);
+    const AssetPack::Source sources[] = {{"assets/big.png", 64, 64, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, texels}};
+    ASSERT_TRUE(AssetPack::Write(file, sources));
+    std::filesystem::resize_file(file, 1000);
+
+    AssetPack pack;
+    EXPECT_FALSE(pack.open(file));
+}
+
+TEST_F(AssetPackTests, RejectsEntrySmallerThanItsImage) {
+    // An 8x8 image recorded with the texels of a 4x4 one would be read past its end
+    std::vector<unsigned char> texels(4 * 4 * 4, 1);
+    const AssetPack::Source sources[] = {{"assets/short.png", 8, 8, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, texels}};
+    ASSERT_TRUE(AssetPack::Write(file, sources));
+
+    AssetPack pack;
+    EXPECT_FALSE(pack.open(file));
+    EXPECT_FALSE(pack.isOpen());
+}
@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+#include "config.hpp"
+#include "core/EntityManager.hpp"
+#include "core/EventBus.hpp"
+#include <algorithm>
+#include <set>
+
+// Car storage is periodically re-sorted along a Morton curve; car pointers change with it.
+
+class CarStorageTests : public ::testing::Test {
+protected:
+    std::shared_ptr<EventBus> bus = std::make_shared<EventBus>();
+    EntityManager entities{bus};
+
+    void SetUp() override { entities.setWorld(std::make_unique<World>(256.0f, 256.0f)); }
+
+    Car *addCar(Vector2 pos, Vector2 vel = {0, 0}) {
+        auto car = std::make_unique<Car>(pos, entities.getWorld(), vel, Car::CarType::COMBUSTION);
+        Car *ptr = car.get();
+        entities.addCar(std::move(car));
+        return ptr;
+    }
+
+    static int quadrant(const Car &car) {
+        Vector2 p = car.getPosition();
+        return (p.x >= 128.0f ? 1 : 0) + (p.y >= 128.0f ? 2 : 0);
+    }
+};
+
+TEST_F(CarStorageTests, ReorderGroupsNeighboursAndKeepsState) {
+    // Spawned round-robin over the four quadrants: neighbours are as far apart as possible in storage
+    for (int i = 0; i < 40; ++i) {
+        float offset = 10.0f + 2.0f * (i / 4);
+        addCar({(i % 2) * 128.0f + offset, ((i / 2) % 2) * 128.0f + offset}, {1.0f * i, 0});
+    }
+    std::multiset<float> speedsBefore;
+    for (const auto &car : entities.getCars())
+        speedsBefore.insert(car->getVelocity().x);
+
+    entities.reorderCars();
+
+    // The curve visits one quadrant after the other
+    const auto &cars = entities.getCars();
+    ASSERT_EQ(cars.size(), 40u);
+    int changes = 0;
+    for (std::size_t i = 1; i < cars.size(); ++i)
+        changes += quadrant(*cars[i]) != quadrant(*cars[i - 1]);
+    EXPECT_EQ(changes, 3);
+
+    std::multiset<float> speedsAfter;
+    for (const auto &car : cars)
+        speedsAfter.insert(car->getVelocity().x);
+    EXPECT_EQ(speedsAfter, speedsBefore);
+}
+
+TEST_F(CarStorageTests, PointersAreRemappedEverywhere) {
+    float x = 0.0f;
+    for (int i = 0; i < 4; ++i) {
+        auto road = std::make_unique<NormalRoad>();
+        road->worldPosition = {x, 200.0f};
+        x += road->getWidth();
+        entities.addModule(std::move(road));
+    }
+    float downY = 200.0f + Config::LANE_OFFSET_DOWN / static_cast<float>(Config::ART_PIXELS_PER_METER);
+    Car *front = addCar({60, downY}, {10, 0});
+    addCar({5, 5});
+    Car *back = addCar({40, downY}, {10, 0});
+    for (Car *car : {front, back})
+        car->setPath(std::vector<Waypoint>{Waypoint({200, downY})});
+    entities.setCarReorderInterval(0);
+    entities.update(Config::FIXED_DELTA_TIME);
+    ASSERT_EQ(back->getLeader(), front);
+
+    // A subscriber holding a car pointer
+    Car *tracked = front;
+    auto token = bus->subscribe<CarsRelocatedEvent>([&tracked](const CarsRelocatedEvent &e) { tracked = e.relocated(tracked); });
+    Vector2 trackedPos = front->getPosition();
+    entities.reorderCars();
+
+    const auto &cars = entities.getCars();
+    EXPECT_TRUE(std::any_of(cars.begin(), cars.end(), [&](const auto &car) { return car.get() == tracked; }));
+    EXPECT_EQ(tracked->getPosition().x, trackedPos.x);
+
+    // Lane queues and leaders point at the new cars
+    int lane = tracked->getLane();
+    ASSERT_GE(lane, 0);
+    auto queue = entities.getLanes().getCars(lane);
+    ASSERT_EQ(queue.size(), 2u);
+    EXPECT_EQ(queue[1], tracked);
+    EXPECT_EQ(queue[0]->getLeader(), tracked);
+}
+
+TEST_F(CarStorageTests, UpdateReordersPeriodically) {
+    addCar({10, 10});
+    addCar({200, 200});
+    int relocations = 0;
+    auto token = bus->subscribe<CarsRelocatedEvent>([&relocations](const CarsRelocatedEvent &) { relocations++; });
+
+    entities.setCarReorderInterval(3);
+    for (int i = 0; i < 7; ++i)
+        entities.update(Config::FIXED_DELTA_TIME);
+    EXPECT_EQ(relocations, 2);
+}
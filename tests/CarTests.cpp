@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+#include "config.hpp"
+#include "entities/Car.hpp"
+#include "raymath.h"
+
+// Runs without a GL context: cars only resolve texture handles, never load them.
+
+TEST(CarTests, RenderPoseBlendsBetweenTicks) {
+    Car car({0, 0}, nullptr, {10, 0}, Car::CarType::COMBUSTION);
+    car.update(Config::FIXED_DELTA_TIME);
+
+    Vector2 start = car.getRenderPosition(0.0f);
+    Vector2 end = car.getRenderPosition(1.0f);
+    Vector2 mid = car.getRenderPosition(0.5f);
+
+    EXPECT_FLOAT_EQ(start.x, 0.0f);
+    EXPECT_FLOAT_EQ(end.x, car.getPosition().x);
+    EXPECT_NEAR(mid.x, (start.x + end.x) / 2.0f, 1e-5f);
+}
+
+TEST(CarTests, RenderRotationTakesShortestWay) {
+    // Heading just below 180 degrees (pointing left, slightly up), then turned across the wrap
+    Car car({0, 0}, nullptr, {-10, -0.5f}, Car::CarType::COMBUSTION);
+    car.setVelocity({-10, 0.5f});
+    car.update(Config::FIXED_DELTA_TIME);
+
+    float from = car.getRenderRotation(0.0f);
+    float to = car.getRenderRotation(1.0f);
+    float mid = car.getRenderRotation(0.5f);
+    EXPECT_LE(std::fabs(mid - from), std::fabs(to - from) + 1e-3f);
+    EXPECT_LT(std::fabs(to - from), 180.0f);
+}
+
+TEST(CarTests, FrictionDoesNotDependOnTickRate) {
+    // No waypoints: a driving car coasts to a stop under per-tick friction
+    auto coast = [](int tickRate) {
+        Car car({0, 0}, nullptr, {10, 0}, Car::CarType::COMBUSTION);
+        for (int i = 0; i < tickRate / 2; ++i) {
+            car.update(1.0 / tickRate);
+        }
+        return Vector2Length(car.getVelocity());
+    };
+
+    float at60 = coast(60);
+    float at20 = coast(20);
+    EXPECT_GT(at60, 0.0f);
+    EXPECT_NEAR(at20, at60, at60 * 0.1f);
+}
+
+TEST(CarTests, CarsShareOnePathWithOwnCursors) {
+    auto path = std::make_shared<const Path>(std::vector<Waypoint>{Waypoint({0.5f, 0}), Waypoint({50, 0}), Waypoint({100, 0})});
+    Car ahead({0, 0}, nullptr, {10, 0}, Car::CarType::COMBUSTION);
+    Car behind({-20, 0}, nullptr, {10, 0}, Car::CarType::COMBUSTION);
+    ahead.setPath(path);
+    behind.setPath(path);
+    EXPECT_EQ(ahead.getPath().get(), behind.getPath().get());
+
+    // The first waypoint is within reach of the car ahead only
+    ahead.update(Config::FIXED_DELTA_TIME);
+    behind.update(Config::FIXED_DELTA_TIME);
+    EXPECT_EQ(ahead.getRemainingWaypoints(), 2u);
+    EXPECT_EQ(behind.getRemainingWaypoints(), 3u);
+    EXPECT_EQ(path->size(), 3u);
+
+    ahead.clearWaypoints();
+    EXPECT_TRUE(ahead.hasArrived());
+    EXPECT_FALSE(behind.hasArrived());
+}
+
+TEST(CarTests, FollowsSparsePathWithoutCorrectionPoints) {
+    // Two straight segments with a right-angle corner at access speed; nothing in between
+    const auto &phase = Config::CarAI::Phases::ACCESS;
+    auto path = std::make_shared<const Path>(std::vector<Waypoint>{
+        Waypoint({40, 0}, phase.tolerance, -1, 0.0f, false, phase.speedFactor),
+        Waypoint({40, 30}, phase.tolerance, -1, PI / 2.0f, false, phase.speedFactor)});
+    Car car({0, 0}, nullptr, {5, 0}, Car::CarType::COMBUSTION);
+    car.setPath(path);
+
+    float maxDeviation = 0.0f;
+    for (int i = 0; i < 60 * 30 && !car.hasArrived(); ++i) {
+        car.update(Config::FIXED_DELTA_TIME);
+        Vector2 p = car.getPosition();
+        // Distance to the polyline: the nearer of the two segments
+        float toFirst = p.x <= 40.0f ? std::fabs(p.y) : Vector2Distance(p, {40, 0});
+        float toSecond = std::fabs(p.x - 40.0f) + std::max(0.0f, -p.y) + std::max(0.0f, p.y - 30.0f);
+        maxDeviation = std::max(maxDeviation, std::min(toFirst, toSecond));
+    }
+
+    EXPECT_TRUE(car.hasArrived());
+    EXPECT_LT(maxDeviation, phase.tolerance);
+}
+
+TEST(CarTests, FootprintsKeepCarsApartWithoutFalseStops) {
+    // Broadphase re-bucketed every tick, as in EntityManager (the standing cars are not updated)
+    SpatialGrid<Car *> grid;
+    grid.reset({-50, -50, 200, 100}, 10.0f);
+    auto rebucket = [&grid](std::initializer_list<Car *> cars) {
+        grid.clear();
+        for (Car *car : cars) {
+            Vector2 p = car->getPosition();
+            grid.insert(car, {p.x - 3.0f, p.y - 3.0f, 6.0f, 6.0f});
+        }
+    };
+
+    const auto &phase = Config::CarAI::Phases::ACCESS;
+    auto path = std::make_shared<const Path>(
+        std::vector<Waypoint>{Waypoint({60, 0}, phase.tolerance, -1, 0.0f, false, phase.speedFactor)});
+
+    // A standing car one lane over (3 m to the side) does not slow a passing car
+    Car passing({0, 0}, nullptr, {5, 0}, Car::CarType::COMBUSTION);
+    Car beside({8, 3.0f}, nullptr, {0.2f, 0}, Car::CarType::COMBUSTION);
+    Car alone({0, 0}, nullptr, {5, 0}, Car::CarType::COMBUSTION);
+    passing.setPath(path);
+    alone.setPath(path);
+    for (int i = 0; i < 120; ++i) {
+        rebucket({&passing, &beside});
+        passing.updateWithNeighbors(Config::FIXED_DELTA_TIME, &grid);
+        alone.update(Config::FIXED_DELTA_TIME);
+    }
+    EXPECT_NEAR(passing.getPosition().x, alone.getPosition().x, 0.05f);
+
+    // A standing car straight ahead: the follower stops short of its footprint
+    Car follower({0, 0}, nullptr, {5, 0}, Car::CarType::COMBUSTION);
+    Car blocking({20, 0}, nullptr, {0.2f, 0}, Car::CarType::COMBUSTION);
+    follower.setPath(path);
+    for (int i = 0; i < 60 * 10; ++i) {
+        rebucket({&follower, &blocking});
+        follower.updateWithNeighbors(Config::FIXED_DELTA_TIME, &grid);
+        ASSERT_FALSE(Overlaps(follower.getFootprint(), blocking.getFootprint())) << "tick " << i;
+    }
+    EXPECT_GT(follower.getPosition().x, 20.0f - Config::CarAI::CAR_LENGTH - 3.0f);
+}
@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+#include "config.hpp"
+#include "core/DetMath.hpp"
+#include "core/EntityManager.hpp"
+#include "core/EventBus.hpp"
+#include "core/ThreadPool.hpp"
+#include <cmath>
+#include <future>
+#include <vector>
+
+// Deterministic builds swap the C library's transcendentals for portable ones; state hashes
+// must only depend on the simulated ticks.
+
+namespace {
+// A road with traffic in both lanes and cars manoeuvring off it, run for a number of ticks
+// (nobody parks: parking durations come from the global random generator)
+std::uint64_t simulate(int ticks) {
+    auto bus = std::make_shared<EventBus>();
+    EntityManager entities(bus);
+
+    float roadLength = 0.0f;
+    for (int i = 0; i < 8; ++i) {
+        auto road = std::make_unique<NormalRoad>();
+        road->worldPosition = {roadLength, 50.0f};
+        roadLength += road->getWidth();
+        entities.addModule(std::move(road));
+    }
+    entities.setWorld(std::make_unique<World>(roadLength, 150.0f));
+
+    const float pixelsPerMeter = static_cast<float>(Config::ART_PIXELS_PER_METER);
+    const float downY = 50.0f + Config::LANE_OFFSET_DOWN / pixelsPerMeter;
+    const float upY = 50.0f + Config::LANE_OFFSET_UP / pixelsPerMeter;
+    auto addCar = [&entities](Vector2 pos, Vector2 vel, Waypoint target) {
+        auto car = std::make_unique<Car>(pos, entities.getWorld(), vel, Car::CarType::COMBUSTION);
+        car->setPath(std::vector<Waypoint>{target});
+        entities.addCar(std::move(car));
+    };
+    for (int i = 0; i < 6; ++i) {
+        addCar({12.0f * i, downY}, {10, 0}, Waypoint({roadLength + 2.0f, downY}, 10.0f, -1, 0.0f, true));
+        addCar({roadLength - 12.0f * i, upY}, {-10, 0}, Waypoint({-2.0f, upY}, 10.0f, -1, 0.0f, true));
+    }
+    const auto &phase = Config::CarAI::Phases::MANEUVER;
+    for (int i = 0; i < 4; ++i) {
+        addCar({20.0f + 6.0f * i, 10.0f}, {0, 1}, Waypoint({30.0f, 40.0f}, phase.tolerance, -1, 0.5f, false, phase.speedFactor));
+    }
+
+    for (int i = 0; i < ticks; ++i) {
+        entities.update(Config::FIXED_DELTA_TIME);
+    }
+    return entities.stateHash();
+}
+} // namespace
+
+TEST(DeterminismTests, PortableMathMatchesTheLibrary) {
+    for (float x = -20.0f; x <= 20.0f; x += 0.0137f) {
+        EXPECT_NEAR(DetMath::PortableSin(x), std::sin(x), 2e-6f) << x;
+        EXPECT_NEAR(DetMath::PortableCos(x), std::cos(x), 2e-6f) << x;
+    }
+    for (float a = 0.0f; a < 6.3f; a += 0.0131f) {
+        for (float r : {1e-3f, 1.0f, 37.0f}) {
+            float x = r * std::cos(a);
+            float y = r * std::sin(a);
+            EXPECT_NEAR(DetMath::PortableAtan2(y, x), std::atan2(y, x), 2e-6f) << x << ", " << y;
+        }
+    }
+    EXPECT_EQ(DetMath::PortableAtan2(0.0f, 0.0f), 0.0f);
+    for (float base : {1e-4f, 0.12f, 0.85f, 0.95f, 1.0f, 3.5f}) {
+        for (float e : {0.0f, 0.25f, 1.0f, 2.5f, 4.0f}) {
+            float expected = std::pow(base, e);
+            EXPECT_NEAR(DetMath::PortablePow(base, e), expected, expected * 2e-6f) << base << "^" << e;
+        }
+    }
+}
+
+TEST(DeterminismTests, StateHashOnlyDependsOnTheTicks) {
+    std::uint64_t first = simulate(600);
+    EXPECT_EQ(simulate(600), first);
+    EXPECT_NE(simulate(599), first);
+
+    // Same result from worker threads, whatever their number
+    for (std::size_t threads : {1u, 4u}) {
+        ThreadPool pool(threads);
+        std::vector<std::future<std::uint64_t>> runs;
+        for (int i = 0; i < 4; ++i) {
+            runs.push_back(pool.submit([] { return simulate(600); }));
+        }
+        for (auto &run : runs) {
+            EXPECT_EQ(run.get(), first);
+        }
+    }
+}
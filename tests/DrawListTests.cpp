@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+#include "core/DrawList.hpp"
+#include "core/EntityManager.hpp"
+#include "core/RenderBackend.hpp"
+#include <memory>
+
+// Runs without a GL context: only the counting backend is used.
+
+class DrawListTests : public ::testing::Test {
+protected:
+    DrawList list;
+    CountingRenderBackend backend;
+
+    static Texture2D fakeTexture(unsigned int id) { return Texture2D{id, 16, 16, 1, 7}; }
+
+    void sprite(DrawLayer layer, unsigned int textureId, float x, float y) {
+        list.sprite(layer, fakeTexture(textureId), {0, 0, 16, 16}, {x, y, 2, 2}, {0, 0}, 0.0f, WHITE);
+    }
+
+    static std::size_t layerIndex(DrawLayer layer) { return static_cast<std::size_t>(layer); }
+};
+
+TEST_F(DrawListTests, GroupsSortableLayerByTexture) {
+    for (int i = 0; i < 100; ++i) {
+        sprite(DrawLayer::STATIC, 1 + (i % 3), (float)i, 0);
+    }
+    list.submit(backend);
+
+    EXPECT_EQ(backend.commands, 100u);
+    EXPECT_EQ(backend.batches, 3u);
+    EXPECT_TRUE(list.getCommands().empty());
+}
+
+TEST_F(DrawListTests, VehiclesKeepRecordingOrder) {
+    // Overlapping cars must stack as recorded, whatever their textures
+    sprite(DrawLayer::VEHICLES, 2, 0, 0);
+    sprite(DrawLayer::VEHICLES, 1, 1, 0);
+    sprite(DrawLayer::VEHICLES, 2, 2, 0);
+    list.submit(backend);
+
+    ASSERT_EQ(backend.log.size(), 3u);
+    EXPECT_EQ(backend.log[0].key, 2u);
+    EXPECT_EQ(backend.log[1].key, 1u);
+    EXPECT_EQ(backend.log[2].key, 2u);
+}
+
+TEST_F(DrawListTests, ShapesDoNotBatchWithTextureZero) {
+    list.rect(DrawLayer::STATIC, {0, 0, 1, 1}, WHITE);
+    sprite(DrawLayer::STATIC, 0, 0, 0);
+    list.submit(backend);
+
+    EXPECT_EQ(backend.batches, 2u);
+}
+
+TEST_F(DrawListTests, OrderedLayerKeepsRecordingOrder) {
+    list.rect(DrawLayer::UI, {0, 0, 10, 10}, BLACK);
+    list.text(DrawLayer::UI, "label", {1, 1}, 20, WHITE);
+    list.rect(DrawLayer::UI, {20, 0, 10, 10}, BLACK);
+    list.submit(backend);
+
+    // Text over a panel must not be reordered under the next panel
+    ASSERT_EQ(backend.log.size(), 3u);
+    EXPECT_EQ(backend.log[0].key, DrawList::SHAPES_KEY);
+    EXPECT_EQ(backend.log[1].key, DrawList::TEXT_KEY);
+    EXPECT_EQ(backend.log[2].key, DrawList::SHAPES_KEY);
+}
+
+TEST_F(DrawListTests, SubmitsLayersBackToFront) {
+    list.rect(DrawLayer::UI, {0, 0, 1, 1}, WHITE);
+    list.rect(DrawLayer::MASK, {0, 0, 1, 1}, WHITE);
+    sprite(DrawLayer::BACKGROUND, 5, 0, 0);
+    list.submit(backend);
+
+    ASSERT_EQ(backend.log.size(), 3u);
+    EXPECT_EQ(backend.log[0].layer, DrawLayer::BACKGROUND);
+    EXPECT_EQ(backend.log[1].layer, DrawLayer::MASK);
+    EXPECT_EQ(backend.log[2].layer, DrawLayer::UI);
+}
+
+TEST_F(DrawListTests, CullsCommandsOutsideArea) {
+    list.setCullArea({0, 0, 10, 10});
+    sprite(DrawLayer::VEHICLES, 1, 5, 5);     // inside
+    sprite(DrawLayer::VEHICLES, 1, 50, 50);   // outside
+    list.line(DrawLayer::DEBUG, {-5, 5}, {20, 5}, 0.0f, BLUE); // crosses the area
+    list.circle(DrawLayer::DEBUG, {30, 30}, 1.0f, BLUE);       // outside
+
+    // Rotated sprite pivoting just outside the area still reaches into it
+    list.sprite(DrawLayer::VEHICLES, fakeTexture(1), {0, 0, 16, 16}, {11, 5, 2, 4}, {1, 2}, 45.0f, WHITE);
+
+    EXPECT_EQ(list.getCulledCount(), 2u);
+    list.submit(backend);
+    EXPECT_EQ(backend.commands, 3u);
+}
+
+TEST_F(DrawListTests, FarLodDrawsVisibleCarsInOneBatch) {
+    auto bus = std::make_shared<EventBus>();
+    EntityManager em(bus);
+    em.setWorld(std::make_unique<World>(400.0f, 100.0f));
+
+    // 300 cars inside the view, 200 far to the right
+    for (int i = 0; i < 500; ++i) {
+        float x = i < 300 ? 10.0f + (i % 30) * 4.0f : 300.0f + (i % 20) * 4.0f;
+        float y = 10.0f + (i / 30 % 10) * 6.0f;
+        auto type = i % 2 ? Car::CarType::ELECTRIC : Car::CarType::COMBUSTION;
+        em.addCar(std::make_unique<Car>(Vector2{x, y}, em.getWorld(), Vector2{0, 0}, type));
+    }
+
+    Rectangle view = {0, 0, 150, 100};
+    list.setCullArea(view);
+    em.draw(view, RenderLod::FAR, list);
+    list.submit(backend);
+
+    EXPECT_EQ(backend.layerCommands[layerIndex(DrawLayer::VEHICLES)], 300u);
+    EXPECT_EQ(backend.layerBatches[layerIndex(DrawLayer::VEHICLES)], 1u);
+}
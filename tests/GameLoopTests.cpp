@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include "core/GameLoop.hpp"
+#include <vector>
 
 // We can't easily mock GetTime() since it's a static Raylib function.
 // But we can verify the loop structure: render is called once per iteration.
@@ -45,3 +46,18 @@ TEST(GameLoopTests, SpeedMultiplierCanBeSet) {
     // For now, this ensures ABI compatibility.
     SUCCEED();
 }
+
+TEST(GameLoopTests, RenderReceivesInterpolationAlpha) {
+    GameLoop loop;
+    int loopCount = 0;
+    std::vector<double> alphas;
+
+    loop.run([](double) {}, [&](double alpha) { alphas.push_back(alpha); },
+             [&]() { return loopCount++ < 5; });
+
+    ASSERT_EQ(alphas.size(), 5u);
+    for (double alpha : alphas) {
+        EXPECT_GE(alpha, 0.0);
+        EXPECT_LT(alpha, 1.0);
+    }
+}
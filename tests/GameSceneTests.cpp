@@ -1,8 +1,12 @@
 #include <gtest/gtest.h>
 #include "scenes/GameScene.hpp"
+#include "core/ThreadPool.hpp"
 #include "core/Window.hpp"
 #include "events/GameEvents.hpp"
+#include <algorithm>
+#include <chrono>
 #include <memory>
+#include <thread>
 
 class GameSceneTests : public ::testing::Test {
 protected:
@@ -41,3 +45,57 @@ TEST_F(GameSceneTests, CanInstantiateAndLoad) {
     
     EXPECT_NO_THROW(scene->unload());
 }
+
+TEST_F(GameSceneTests, BuildsWorldOnWorkerThenStartsSimulation) {
+    ThreadPool pool(1);
+    MapConfig config;
+    config.largeParkingCount = 3;
+
+    std::vector<float> progress;
+    auto progressToken = bus->subscribe<WorldLoadProgressEvent>(
+        [&progress](const WorldLoadProgressEvent &e) { progress.push_back(e.fraction); });
+    bool boundsPublished = false;
+    auto boundsToken = bus->subscribe<WorldBoundsEvent>([&boundsPublished](const WorldBoundsEvent &) { boundsPublished = true; });
+
+    auto scene = std::make_unique<GameScene>(bus, config, &pool);
+    scene->load();
+
+    // The loading screen draws and updates while the worker runs
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (scene->isLoading() && std::chrono::steady_clock::now() < deadline) {
+        EXPECT_NO_THROW(scene->draw());
+        scene->update(0.1);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    EXPECT_FALSE(scene->isLoading());
+    EXPECT_TRUE(boundsPublished);
+    ASSERT_FALSE(progress.empty());
+    EXPECT_TRUE(std::is_sorted(progress.begin(), progress.end()));
+
+    EXPECT_NO_THROW(scene->update(0.1));
+    EXPECT_NO_THROW(scene->draw());
+    EXPECT_NO_THROW(scene->unload());
+}
+
+TEST_F(GameSceneTests, UnloadWhileBuildingLeavesNoJobBehind) {
+    ThreadPool pool(2);
+    MapConfig config;
+    config.largeParkingCount = 20;
+
+    auto scene = std::make_unique<GameScene>(bus, config, &pool);
+    scene->load();
+    scene->unload();
+    EXPECT_FALSE(scene->isLoading());
+
+    // The next scene's generation job runs alone
+    auto next = std::make_unique<GameScene>(bus, config, &pool);
+    next->load();
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (next->isLoading() && std::chrono::steady_clock::now() < deadline) {
+        next->update(0.1);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_FALSE(next->isLoading());
+    next->unload();
+}
@@ -0,0 +1,165 @@
+#include <gtest/gtest.h>
+#include "config.hpp"
+#include "core/LaneQueues.hpp"
+#include "raymath.h"
+
+// Cars on the main road are queued per lane, ordered, and told which car they follow.
+
+class LaneQueuesTests : public ::testing::Test {
+protected:
+    std::vector<std::unique_ptr<Module>> modules;
+    std::vector<std::unique_ptr<Car>> cars;
+    LaneQueues lanes;
+    float downY = 0.0f; ///< Lane driving towards +X
+    float upY = 0.0f;   ///< Lane driving towards -X
+    float roadEnd = 0.0f;
+
+    void SetUp() override {
+        float x = 0.0f;
+        for (int i = 0; i < 4; ++i) {
+            auto road = std::make_unique<NormalRoad>();
+            road->worldPosition = {x, 20.0f};
+            x += road->getWidth();
+            modules.push_back(std::move(road));
+        }
+        roadEnd = x;
+        downY = 20.0f + Config::LANE_OFFSET_DOWN / static_cast<float>(Config::ART_PIXELS_PER_METER);
+        upY = 20.0f + Config::LANE_OFFSET_UP / static_cast<float>(Config::ART_PIXELS_PER_METER);
+        lanes.build(modules);
+    }
+
+    Car *addCar(Vector2 pos, Vector2 vel) {
+        cars.push_back(std::make_unique<Car>(pos, nullptr, vel, Car::CarType::COMBUSTION));
+        return cars.back().get();
+    }
+
+    void drive(Car *car, float x) {
+        car->setPath(std::vector<Waypoint>{Waypoint({x, car->getPosition().y})});
+    }
+};
+
+TEST_F(LaneQueuesTests, OneRowGivesTwoLanes) {
+    EXPECT_EQ(lanes.getLaneCount(), 2u);
+    Car *down = addCar({5, downY}, {10, 0});
+    Car *up = addCar({5, upY}, {-10, 0});
+    Car *off = addCar({5, 0}, {10, 0});
+    Car *wrongWay = addCar({5, downY}, {-10, 0});
+    EXPECT_GE(lanes.laneFor(*down), 0);
+    EXPECT_GE(lanes.laneFor(*up), 0);
+    EXPECT_NE(lanes.laneFor(*down), lanes.laneFor(*up));
+    EXPECT_EQ(lanes.laneFor(*off), -1);
+    EXPECT_EQ(lanes.laneFor(*wrongWay), -1);
+}
+
+TEST_F(LaneQueuesTests, QueuesStaySortedAndLeadersPointAhead) {
+    Car *middle = addCar({20, downY}, {10, 0});
+    Car *back = addCar({5, downY}, {10, 0});
+    Car *front = addCar({40, downY}, {10, 0});
+    Car *oncoming = addCar({30, upY}, {-10, 0});
+    lanes.update(cars);
+
+    int lane = back->getLane();
+    ASSERT_GE(lane, 0);
+    auto queue = lanes.getCars(lane);
+    ASSERT_EQ(queue.size(), 3u);
+    EXPECT_EQ(queue[0], back);
+    EXPECT_EQ(queue[2], front);
+    EXPECT_EQ(back->getLeader(), middle);
+    EXPECT_EQ(middle->getLeader(), front);
+    EXPECT_EQ(front->getLeader(), nullptr);
+    EXPECT_EQ(oncoming->getLeader(), nullptr);
+
+    // A car that leaves hands its follower the next car ahead
+    lanes.remove(middle);
+    EXPECT_EQ(back->getLeader(), front);
+    EXPECT_EQ(middle->getLane(), -1);
+
+    // Still on the lane line: it rejoins at the back of the queue and is sorted into place
+    lanes.update(cars);
+    queue = lanes.getCars(lane);
+    ASSERT_EQ(queue.size(), 3u);
+    EXPECT_EQ(queue[1], middle);
+    EXPECT_EQ(back->getLeader(), middle);
+}
+
+TEST_F(LaneQueuesTests, FollowerKeepsItsDistanceWithoutNeighbourScan) {
+    // Leader stands still halfway along the road; the follower arrives at full speed
+    Car *leader = addCar({roadEnd / 2, downY}, {0, 0});
+    Car *follower = addCar({0, downY}, {15, 0});
+    drive(leader, leader->getPosition().x + 0.5f);
+    drive(follower, roadEnd);
+
+    float closest = std::numeric_limits<float>::max();
+    for (int i = 0; i < 60 * 10; ++i) {
+        lanes.update(cars);
+        leader->setVelocity({0, 0});
+        follower->update(Config::FIXED_DELTA_TIME); // No car list: only the lane leader is known
+        closest = std::min(closest, leader->getPosition().x - follower->getPosition().x);
+    }
+
+    EXPECT_EQ(follower->getLeader(), leader);
+    EXPECT_GT(closest, Config::CarAI::CAR_LENGTH);
+    EXPECT_LT(Vector2Length(follower->getVelocity()), 0.5f);
+    EXPECT_LT(leader->getPosition().x - follower->getPosition().x,
+              Config::CarAI::CAR_LENGTH + Config::CarAI::Lanes::MIN_GAP + 2.0f);
+}
+
+TEST_F(LaneQueuesTests, IsolatedCruiserDropsToReducedRateUntilSomeoneCloses) {
+    Car *cruiser = addCar({5, downY}, {15, 0});
+    drive(cruiser, roadEnd + 2.0f);
+
+    for (int i = 0; i < 30; ++i) {
+        lanes.update(cars);
+        cruiser->update(Config::FIXED_DELTA_TIME);
+    }
+    EXPECT_EQ(cruiser->getSimLod(), Car::SimLod::CRUISE);
+
+    // A car entering the lane right behind promotes it on its next tick
+    Car *chaser = addCar({cruiser->getPosition().x - 10.0f, downY}, {15, 0});
+    drive(chaser, roadEnd + 2.0f);
+    lanes.update(cars);
+    cruiser->update(Config::FIXED_DELTA_TIME);
+    EXPECT_EQ(cruiser->getSimLod(), Car::SimLod::FULL);
+}
+
+TEST_F(LaneQueuesTests, CruisingMatchesFullRateTrajectory) {
+    auto run = [this](bool lod) {
+        Car::SetSimLodEnabled(lod);
+        lanes.clear(); // Before the cars it points to go away
+        cars.clear();
+        lanes.build(modules);
+        Car *car = addCar({5, downY}, {15, 0});
+        drive(car, roadEnd + 2.0f);
+        for (int i = 0; i < 120; ++i) {
+            lanes.update(cars);
+            car->update(Config::FIXED_DELTA_TIME);
+        }
+        return car->getPosition();
+    };
+
+    Vector2 full = run(false);
+    Vector2 reduced = run(true);
+    Car::SetSimLodEnabled(true);
+    EXPECT_NEAR(reduced.x, full.x, 0.5f);
+    EXPECT_NEAR(reduced.y, full.y, 0.1f);
+}
+
+TEST_F(LaneQueuesTests, CruiseEndsBeforeTheNextTurn) {
+    // Straight down the lane, then a right angle off the road
+    Car *car = addCar({5, downY}, {15, 0});
+    Vector2 corner = {120.0f, downY};
+    car->setPath(std::vector<Waypoint>{Waypoint(corner, 3.0f), Waypoint({corner.x, downY + 30.0f})});
+
+    bool cruised = false;
+    for (int i = 0; i < 60 * 10 && car->getRemainingWaypoints() == 2; ++i) {
+        lanes.update(cars);
+        car->update(Config::FIXED_DELTA_TIME);
+        cruised |= car->getSimLod() == Car::SimLod::CRUISE;
+        // Close to the turn the car must be simulated at full rate
+        if (corner.x - car->getPosition().x < Config::CarAI::SimLod::CLEAR_AHEAD / 2) {
+            EXPECT_EQ(car->getSimLod(), Car::SimLod::FULL);
+        }
+    }
+    EXPECT_TRUE(cruised);
+    EXPECT_EQ(car->getRemainingWaypoints(), 1u);
+}
@@ -0,0 +1,44 @@
+#include <gtest/gtest.h>
+#include "core/OrientedBox.hpp"
+#include "raymath.h"
+
+namespace {
+// A car-sized box (about 2.4 x 4.4 m) heading along the given direction
+OrientedBox carBox(Vector2 center, Vector2 forward) { return {center, Vector2Normalize(forward), 2.2f, 1.2f}; }
+} // namespace
+
+TEST(OrientedBoxTests, ParallelCarsSideBySideDoNotOverlap) {
+    OrientedBox a = carBox({0, 0}, {0, 1});
+    OrientedBox b = carBox({2.6f, 0}, {0, 1});
+    EXPECT_FALSE(Overlaps(a, b));
+    EXPECT_FALSE(Overlaps(b, a));
+
+    OrientedBox closer = carBox({2.0f, 0}, {0, 1});
+    EXPECT_TRUE(Overlaps(a, closer));
+}
+
+TEST(OrientedBoxTests, RotatedBoxesSeparatedAlongTheirOwnAxes) {
+    // Bounding boxes overlap, but the diagonal cars pass each other
+    OrientedBox a = carBox({0, 0}, {1, 1});
+    OrientedBox b = carBox({2.5f, -2.5f}, {1, 1});
+    Rectangle ra = a.bounds();
+    Rectangle rb = b.bounds();
+    EXPECT_TRUE(CheckCollisionRecs(ra, rb));
+    EXPECT_FALSE(Overlaps(a, b));
+
+    // Crossing at right angles through the same point
+    EXPECT_TRUE(Overlaps(a, carBox({0.5f, 0.5f}, {1, -1})));
+}
+
+TEST(OrientedBoxTests, PushSeparatesAlongTheShallowestAxis) {
+    OrientedBox a = carBox({0, 0}, {0, 1});
+    OrientedBox b = carBox({2.0f, 0.5f}, {0, 1});
+    Vector2 push;
+    ASSERT_TRUE(Overlaps(a, b, &push));
+
+    // 0.4 m of side overlap, moving a away from b (towards -X)
+    EXPECT_NEAR(push.x, -0.4f, 1e-4f);
+    EXPECT_NEAR(push.y, 0.0f, 1e-4f);
+    a.center = Vector2Add(a.center, Vector2Scale(push, 1.01f));
+    EXPECT_FALSE(Overlaps(a, b));
+}
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+#include "config.hpp"
+#include "core/RedrawTracker.hpp"
+#include "events/GameEvents.hpp"
+#include "events/InputEvents.hpp"
+#include "events/TrackingEvents.hpp"
+#include "systems/TrackingSystem.hpp"
+
+class RedrawTrackerTests : public ::testing::Test {
+protected:
+    std::shared_ptr<EventBus> bus = std::make_shared<EventBus>();
+    RedrawTracker tracker{bus};
+
+    int renderedFrames(int frames) {
+        int count = 0;
+        for (int i = 0; i < frames; ++i) {
+            if (tracker.shouldRender())
+                count++;
+        }
+        return count;
+    }
+};
+
+TEST_F(RedrawTrackerTests, GoesIdleAfterSettleFrames) {
+    if (!Config::Render::ON_DEMAND_RENDERING)
+        GTEST_SKIP() << "On-demand rendering disabled";
+
+    // The first frames are always drawn
+    EXPECT_EQ(renderedFrames(100), Config::Render::REDRAW_SETTLE_FRAMES);
+    EXPECT_FALSE(tracker.isDirty());
+}
+
+TEST_F(RedrawTrackerTests, ChangesWakeItUp) {
+    if (!Config::Render::ON_DEMAND_RENDERING)
+        GTEST_SKIP() << "On-demand rendering disabled";
+    renderedFrames(100);
+
+    bus->publish(GameUpdateEvent{Config::FIXED_DELTA_TIME});
+    EXPECT_EQ(renderedFrames(100), Config::Render::REDRAW_SETTLE_FRAMES);
+
+    bus->publish(KeyPressedEvent{KEY_P});
+    EXPECT_TRUE(tracker.isDirty());
+    renderedFrames(100);
+
+    bus->publish(CameraZoomEvent{0.1f});
+    EXPECT_TRUE(tracker.isDirty());
+}
+
+TEST_F(RedrawTrackerTests, StillMouseDoesNotRedraw) {
+    if (!Config::Render::ON_DEMAND_RENDERING)
+        GTEST_SKIP() << "On-demand rendering disabled";
+
+    // The input system publishes the mouse position every frame
+    bus->publish(MouseMovedEvent{{100, 100}});
+    renderedFrames(100);
+
+    bus->publish(MouseMovedEvent{{100, 100}});
+    EXPECT_FALSE(tracker.isDirty());
+
+    bus->publish(MouseMovedEvent{{101, 100}});
+    EXPECT_TRUE(tracker.isDirty());
+}
+
+TEST_F(RedrawTrackerTests, TrackingAStillCarGoesIdle) {
+    if (!Config::Render::ON_DEMAND_RENDERING)
+        GTEST_SKIP() << "On-demand rendering disabled";
+
+    TrackingSystem tracking(bus);
+    Car car({10.0f, 10.0f}, nullptr, {0, 0}, Car::CarType::COMBUSTION);
+    bus->publish(StartTrackingEvent{});
+    bus->publish(CarSpawnedEvent{&car});
+
+    // Paused: the car does not move, so following it every frame is not a change
+    tracking.follow(1.0f);
+    renderedFrames(100);
+    tracking.follow(1.0f);
+    tracking.follow(0.5f);
+    EXPECT_FALSE(tracker.isDirty());
+}
@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+#include "config.hpp"
+#include "systems/RoadFlow.hpp"
+
+// The mesoscopic road conserves vehicles, moves them at free speed and never beats capacity.
+
+class RoadFlowTests : public ::testing::Test {
+protected:
+    std::vector<std::unique_ptr<Module>> modules;
+    RoadFlow flow;
+    float roadLength = 0.0f;
+
+    void SetUp() override {
+        for (int i = 0; i < 10; ++i) {
+            auto road = std::make_unique<NormalRoad>();
+            road->worldPosition = {roadLength, 20.0f};
+            roadLength += road->getWidth();
+            modules.push_back(std::move(road));
+        }
+        flow.build(modules);
+    }
+
+    void run(float seconds) {
+        for (int i = 0; i < (int)(seconds / Config::FIXED_DELTA_TIME); ++i)
+            flow.step(Config::FIXED_DELTA_TIME);
+    }
+};
+
+TEST_F(RoadFlowTests, VehiclesAreConserved) {
+    ASSERT_TRUE(flow.isBuilt());
+    flow.addVehicles(true, 30.0f);
+    flow.addVehicles(false, 12.5f);
+    run(10.0f);
+
+    float total = flow.getVehiclesOnRoad() + flow.getQueuedVehicles() + (float)flow.getExitedVehicles();
+    EXPECT_NEAR(total, 42.5f, 1e-3f);
+    EXPECT_FALSE(flow.isEmpty());
+}
+
+TEST_F(RoadFlowTests, FreeFlowCrossesAtFreeSpeed) {
+    flow.addVehicles(true, 1.0f);
+    float travelTime = roadLength / Config::Flow::FREE_SPEED;
+
+    run(travelTime * 0.5f);
+    EXPECT_LT(flow.getExitedVehicles(), 0.05);
+    run(travelTime * 2.0f);
+    EXPECT_GT(flow.getExitedVehicles(), 0.95);
+}
+
+TEST_F(RoadFlowTests, ThroughputIsCappedByCapacity) {
+    // Demand far above what one lane carries: the surplus waits at the entry
+    const float demandPerSecond = 20000.0f / 3600.0f;
+    const float seconds = 120.0f;
+    for (int i = 0; i < (int)(seconds / Config::FIXED_DELTA_TIME); ++i) {
+        flow.addVehicles(true, demandPerSecond * Config::FIXED_DELTA_TIME);
+        flow.step(Config::FIXED_DELTA_TIME);
+    }
+
+    EXPECT_LE(flow.getExitedVehicles(), Config::Flow::CAPACITY * seconds);
+    EXPECT_GT(flow.getQueuedVehicles(), 0.5f * demandPerSecond * seconds);
+    for (std::size_t i = 0; i < flow.getCellCount(); ++i)
+        EXPECT_LE(flow.getDensity(true, i), Config::Flow::JAM_DENSITY + 1e-4f);
+}
@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include "entities/Car.hpp"
+#include "systems/PathPlanner.hpp"
+#include "systems/RouteTable.hpp"
+
+// Looked-up routes must match the paths PathPlanner builds from scratch.
+
+class RouteTableTests : public ::testing::Test {
+protected:
+    std::vector<std::unique_ptr<Module>> modules;
+    Module *facility = nullptr;
+
+    void SetUp() override {
+        auto left = std::make_unique<NormalRoad>();
+        auto road = std::make_unique<DoubleEntranceRoad>();
+        road->worldPosition = {left->getWidth(), 20.0f};
+        left->worldPosition = {0.0f, 20.0f};
+        auto parking = std::make_unique<SmallParking>(true);
+        parking->worldPosition = {road->worldPosition.x, road->worldPosition.y - parking->getHeight()};
+        parking->setParent(road.get());
+        facility = parking.get();
+
+        modules.push_back(std::move(parking));
+        modules.push_back(std::move(left));
+        modules.push_back(std::move(road));
+    }
+
+    static void expectSamePath(const PathHandle &handle, const std::vector<Waypoint> &b) {
+        ASSERT_NE(handle, nullptr);
+        const Path &a = *handle;
+        ASSERT_EQ(a.size(), b.size());
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            EXPECT_FLOAT_EQ(a[i].position.x, b[i].position.x);
+            EXPECT_FLOAT_EQ(a[i].position.y, b[i].position.y);
+            EXPECT_FLOAT_EQ(a[i].speedLimitFactor, b[i].speedLimitFactor);
+            EXPECT_EQ(a[i].stopAtEnd, b[i].stopAtEnd);
+        }
+    }
+};
+
+TEST_F(RouteTableTests, EntryPathMatchesPlanner) {
+    RouteTable routes;
+    routes.build(modules);
+    EXPECT_FLOAT_EQ(routes.getMinRoadX(), 0.0f);
+
+    Car car({0.0f, 30.0f}, nullptr, {15.0f, 0.0f}, Car::CarType::COMBUSTION);
+    for (int s : {0, 7}) {
+        Spot spot = facility->getSpot(s);
+        auto looked = routes.entryPath(car.getPosition(), facility, s, PathPlanner::MainRoadLane(&car));
+        expectSamePath(looked, PathPlanner::GeneratePath(&car, facility, spot));
+        EXPECT_TRUE((*looked)[looked->size() - 1].stopAtEnd);
+    }
+}
+
+TEST_F(RouteTableTests, ExitPathMatchesPlanner) {
+    RouteTable routes;
+    routes.build(modules);
+
+    Spot spot = facility->getSpot(3);
+    Vector2 parked = {facility->worldPosition.x + spot.localPosition.x, facility->worldPosition.y + spot.localPosition.y};
+    Car car(parked, nullptr, {0.0f, 0.0f}, Car::CarType::COMBUSTION);
+
+    for (bool exitRight : {false, true}) {
+        float finalX = exitRight ? routes.getMaxRoadX() + 2.0f : routes.getMinRoadX() - 2.0f;
+        expectSamePath(routes.exitPath(facility, 3, exitRight),
+                       PathPlanner::GenerateExitPath(&car, facility, spot, exitRight, finalX));
+    }
+}
+
+TEST_F(RouteTableTests, UnknownFacilityOrSpotGivesEmptyPath) {
+    RouteTable routes;
+    routes.build(modules);
+    SmallParking other(false);
+
+    EXPECT_EQ(routes.entryPath({0, 0}, &other, 0, Lane::UP), nullptr);
+    EXPECT_EQ(routes.entryPath({0, 0}, facility, 999, Lane::UP), nullptr);
+    EXPECT_EQ(routes.exitPath(modules[1].get(), 0, true), nullptr);
+}
+
+TEST_F(RouteTableTests, PathsOutliveRebuiltTable) {
+    RouteTable routes;
+    routes.build(modules);
+    PathHandle path = routes.entryPath({0.0f, 30.0f}, facility, 2, Lane::DOWN);
+    ASSERT_NE(path, nullptr);
+    Waypoint last = (*path)[path->size() - 1];
+
+    routes.clear();
+    EXPECT_FLOAT_EQ((*path)[path->size() - 1].position.x, last.position.x);
+}
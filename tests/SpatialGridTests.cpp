@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+#include "core/SpatialGrid.hpp"
+#include <algorithm>
+#include <vector>
+
+class SpatialGridTests : public ::testing::Test {
+protected:
+    SpatialGrid<int> grid;
+
+    void SetUp() override {
+        grid.reset({0, 0, 100, 100}, 10.0f);
+    }
+
+    std::vector<int> query(Rectangle area) {
+        std::vector<int> found;
+        grid.query(area, [&](int item) { found.push_back(item); });
+        std::sort(found.begin(), found.end());
+        return found;
+    }
+};
+
+TEST_F(SpatialGridTests, ReturnsOnlyOverlappingItems) {
+    grid.insert(1, {5, 5, 2, 2});
+    grid.insert(2, {50, 50, 2, 2});
+    grid.insert(3, {95, 5, 2, 2});
+
+    EXPECT_EQ(query({0, 0, 20, 20}), (std::vector<int>{1}));
+    EXPECT_EQ(query({40, 0, 60, 100}), (std::vector<int>{2, 3}));
+    EXPECT_TRUE(query({20, 20, 5, 5}).empty());
+}
+
+TEST_F(SpatialGridTests, LargeItemsAreFoundFromDistantCells) {
+    // Centered in one cell but spanning many others; must be reported exactly once
+    grid.insert(7, {0, 0, 60, 10});
+
+    EXPECT_EQ(query({55, 2, 1, 1}), (std::vector<int>{7}));
+    EXPECT_EQ(query({0, 0, 100, 100}), (std::vector<int>{7}));
+}
+
+TEST_F(SpatialGridTests, ItemsOutsideTheAreaAreClampedIntoBorderCells) {
+    grid.insert(4, {-30, 50, 2, 2});
+    grid.insert(5, {150, 150, 2, 2});
+
+    EXPECT_EQ(query({-40, 40, 20, 20}), (std::vector<int>{4}));
+    EXPECT_EQ(query({140, 140, 20, 20}), (std::vector<int>{5}));
+    EXPECT_TRUE(query({0, 0, 100, 100}).empty());
+}
+
+TEST_F(SpatialGridTests, RemoveAndClear) {
+    grid.insert(1, {5, 5, 2, 2});
+    grid.insert(2, {6, 6, 2, 2});
+
+    EXPECT_TRUE(grid.remove(1, {5, 5, 2, 2}));
+    EXPECT_FALSE(grid.remove(1, {5, 5, 2, 2}));
+    EXPECT_EQ(query({0, 0, 10, 10}), (std::vector<int>{2}));
+
+    grid.clear();
+    EXPECT_EQ(grid.getCount(), 0u);
+    EXPECT_TRUE(query({0, 0, 100, 100}).empty());
+}
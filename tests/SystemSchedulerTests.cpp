@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+#include "config.hpp"
+#include "core/SystemScheduler.hpp"
+#include "core/ThreadPool.hpp"
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Systems run at their declared rates on the fixed tick, slow ones on staggered ticks, and in
+// stages built from their declared state access.
+
+namespace {
+constexpr double TICK = Config::FIXED_DELTA_TIME;
+}
+
+TEST(SystemSchedulerTests, RunsEachSystemAtItsRate) {
+    SystemScheduler scheduler;
+    int physics = 0, parking = 0, statistics = 0;
+    scheduler.add("physics", 60.0, [&](double) { physics++; });
+    scheduler.add("parking", 1.0, [&](double) { parking++; });
+    scheduler.add("statistics", 0.2, [&](double) { statistics++; });
+
+    for (int i = 0; i < 10 * Config::TICK_RATE; ++i)
+        scheduler.tick(TICK);
+
+    EXPECT_EQ(physics, 600);
+    EXPECT_EQ(parking, 10);
+    EXPECT_EQ(statistics, 2);
+}
+
+TEST(SystemSchedulerTests, PassesTimeSinceLastRun) {
+    SystemScheduler scheduler;
+    std::vector<double> steps;
+    scheduler.add("busy", 1.0, [](double) {});
+    scheduler.add("slow", 1.0, [&](double dt) { steps.push_back(dt); });
+
+    for (int i = 0; i < 5 * Config::TICK_RATE; ++i)
+        scheduler.tick(TICK);
+
+    ASSERT_EQ(steps.size(), 5u);
+    // The first run covers the ticks up to its phase, every later run a whole second
+    double total = 0.0;
+    for (std::size_t i = 0; i < steps.size(); ++i) {
+        if (i > 0) {
+            EXPECT_NEAR(steps[i], 1.0, 1e-9);
+        }
+        total += steps[i];
+    }
+    double pending = scheduler.getSystems()[1].pendingDt;
+    EXPECT_NEAR(total + pending, 5.0, 1e-9);
+}
+
+TEST(SystemSchedulerTests, StaggersSlowSystems) {
+    SystemScheduler scheduler;
+    std::map<unsigned long long, int> slowRunsPerTick;
+    unsigned long long tick = 0;
+    scheduler.add("physics", 60.0, [](double) {});
+    for (double rate : {1.0, 1.0, 1.0, 0.2, 0.5})
+        scheduler.add("slow", rate, [&](double) { slowRunsPerTick[tick]++; });
+
+    for (; tick < 60ULL * Config::TICK_RATE; ++tick)
+        scheduler.tick(TICK);
+
+    ASSERT_FALSE(slowRunsPerTick.empty());
+    for (const auto &[t, runs] : slowRunsPerTick)
+        EXPECT_EQ(runs, 1) << "tick " << t;
+}
+
+TEST(SystemSchedulerTests, StagesFollowDeclaredAccess) {
+    SystemScheduler scheduler;
+    auto noop = [](double) {};
+    scheduler.add("physics", 60.0, {0, SimState::CAR_KINEMATICS}, noop);
+    scheduler.add("camera", 60.0, {0, SimState::CAMERA}, noop);
+    scheduler.add("traffic", 60.0, {SimState::CAR_KINEMATICS, SimState::SPOT_STATE}, noop);
+    scheduler.add("statistics", 0.2, {SimState::SPOT_STATE, 0}, noop);
+    scheduler.add("readers", 60.0, {SimState::CAMERA, 0}, noop);
+
+    const auto &stages = scheduler.getStages();
+    ASSERT_EQ(stages.size(), 3u);
+    EXPECT_EQ(stages[0], (std::vector<std::size_t>{0, 1}));
+    EXPECT_EQ(stages[1], (std::vector<std::size_t>{2, 4}));
+    EXPECT_EQ(stages[2], (std::vector<std::size_t>{3}));
+    EXPECT_EQ(scheduler.getSystems()[2].after, (std::vector<std::size_t>{0}));
+
+    std::string dot = scheduler.toDot();
+    EXPECT_NE(dot.find("s0 -> s2 [label=\"car kinematics\"]"), std::string::npos);
+    EXPECT_NE(dot.find("s2 -> s3 [label=\"spot state\"]"), std::string::npos);
+    EXPECT_EQ(dot.find("s0 -> s1"), std::string::npos);
+}
+
+TEST(SystemSchedulerTests, RunsIndependentSystemsConcurrently) {
+    ThreadPool pool(2);
+    SystemScheduler scheduler;
+    scheduler.setWorkers(&pool);
+
+    // Each of the first two only finishes once the other has started, so they must overlap
+    std::atomic<int> started = 0;
+    std::atomic<int> overlapped = 0;
+    auto meet = [&](double) {
+        started++;
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (started.load() % 2 != 0 && std::chrono::steady_clock::now() < deadline)
+            std::this_thread::yield();
+        if (started.load() % 2 == 0)
+            overlapped++;
+    };
+    std::vector<int> afterBoth;
+    scheduler.add("left", 60.0, {0, SimState::CAR_KINEMATICS}, meet);
+    scheduler.add("right", 60.0, {0, SimState::CAMERA}, meet);
+    scheduler.add("reader", 60.0, {SimState::CAR_KINEMATICS | SimState::CAMERA, 0},
+                  [&](double) { afterBoth.push_back(overlapped.load()); });
+
+    for (int i = 0; i < 3; ++i)
+        scheduler.tick(TICK);
+
+    EXPECT_EQ(overlapped.load(), 6);
+    EXPECT_EQ(afterBoth, (std::vector<int>{2, 4, 6}));
+}
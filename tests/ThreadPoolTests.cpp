@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include "core/AssetManager.hpp"
+#include "core/ThreadPool.hpp"
+#include <atomic>
+#include <stdexcept>
+
+TEST(ThreadPoolTests, RunsEveryJobAndReturnsResults) {
+    ThreadPool pool(4);
+    std::atomic<int> counter{0};
+    std::vector<std::future<int>> results;
+
+    for (int i = 0; i < 100; ++i) {
+        results.push_back(pool.submit([i, &counter]() {
+            counter++;
+            return i * i;
+        }));
+    }
+
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(results[i].get(), i * i);
+    }
+    EXPECT_EQ(counter.load(), 100);
+}
+
+TEST(ThreadPoolTests, PropagatesExceptions) {
+    ThreadPool pool(1);
+    auto result = pool.submit([]() -> int { throw std::runtime_error("job failed"); });
+    EXPECT_THROW(result.get(), std::runtime_error);
+}
+
+TEST(ThreadPoolTests, DestructorFinishesQueuedJobs) {
+    std::atomic<int> counter{0};
+    {
+        ThreadPool pool(2);
+        for (int i = 0; i < 50; ++i) {
+            pool.submit([&counter]() { counter++; });
+        }
+    }
+    EXPECT_EQ(counter.load(), 50);
+}
+
+TEST(ThreadPoolTests, ManifestDecodesEachPathOnce) {
+    // No GL context here: decoding fails, but the report still lists each distinct file once
+    const AssetManifestEntry entries[] = {
+        {"manifest_test_a", "assets/does_not_exist_1.png"},
+        {"manifest_test_b", "assets/does_not_exist_1.png"},
+        {"manifest_test_c", "assets/does_not_exist_2.png"},
+        {"manifest_test_a", "assets/does_not_exist_1.png"},
+    };
+
+    ThreadPool pool(2);
+    auto report = AssetManager::Get().LoadManifest(entries, pool);
+
+    ASSERT_EQ(report.size(), 2u);
+    EXPECT_EQ(report[0].path, "assets/does_not_exist_1.png");
+    EXPECT_EQ(report[0].name, "manifest_test_a");
+    EXPECT_EQ(report[1].path, "assets/does_not_exist_2.png");
+    EXPECT_FALSE(report[0].loaded);
+}
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+#include "entities/map/WorldSnapshot.hpp"
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+
+class WorldSnapshotTests : public ::testing::Test {
+protected:
+    std::string file = (std::filesystem::temp_directory_path() / "parklogic_test.snapshot").string();
+
+    void TearDown() override { std::remove(file.c_str()); }
+};
+
+TEST_F(WorldSnapshotTests, RoundTripsWorld) {
+    World world(80.0f, 60.0f);
+    std::vector<std::unique_ptr<Module>> modules;
+    modules.push_back(std::make_unique<SmallParking>(true));
+    modules.push_back(std::make_unique<NormalRoad>());
+    modules.push_back(std::make_unique<UpEntranceRoad>());
+    modules[0]->setParent(modules[2].get());
+    modules[0]->worldPosition = {12.5f, 3.0f};
+    modules[2]->worldPosition = {40.0f, 50.0f};
+    modules[0]->setSpotPrice(3, 7.25f);
+
+    ASSERT_TRUE(WorldSnapshot::Write(file, world, modules));
+
+    auto loaded = WorldSnapshot::Load(file);
+    ASSERT_TRUE(loaded.has_value());
+    ASSERT_EQ(loaded->modules.size(), modules.size());
+
+    const World &copy = *loaded->world;
+    EXPECT_FLOAT_EQ(copy.getWidth(), 80.0f);
+    EXPECT_FLOAT_EQ(copy.getHeight(), 60.0f);
+    ASSERT_EQ(copy.getTileColumns(), world.getTileColumns());
+    ASSERT_EQ(copy.getTileRows(), world.getTileRows());
+    for (int row = 0; row < world.getTileRows(); ++row)
+        for (int col = 0; col < world.getTileColumns(); ++col)
+            EXPECT_EQ(copy.getTile(col, row), world.getTile(col, row));
+
+    const Module &facility = *loaded->modules[0];
+    EXPECT_EQ(facility.getType(), ModuleType::SMALL_PARKING);
+    EXPECT_TRUE(facility.isUp());
+    EXPECT_EQ(facility.getParent(), loaded->modules[2].get());
+    EXPECT_FLOAT_EQ(facility.worldPosition.x, 12.5f);
+    EXPECT_FLOAT_EQ(facility.getPriceMultiplier(), modules[0]->getPriceMultiplier());
+    ASSERT_EQ(facility.getSpotCount(), modules[0]->getSpotCount());
+    for (int s = 0; s < (int)facility.getSpotCount(); ++s)
+        EXPECT_FLOAT_EQ(facility.getSpot(s).price, modules[0]->getSpot(s).price);
+    EXPECT_FLOAT_EQ(facility.getSpot(3).price, 7.25f);
+
+    EXPECT_EQ(loaded->modules[1]->getParent(), nullptr);
+    EXPECT_NE(dynamic_cast<const UpEntranceRoad *>(loaded->modules[2].get()), nullptr);
+    EXPECT_FLOAT_EQ(loaded->modules[2]->worldPosition.y, 50.0f);
+}
+
+TEST_F(WorldSnapshotTests, RejectsMissingForeignOrTruncatedFiles) {
+    WorldSnapshot snapshot;
+    EXPECT_FALSE(snapshot.open(file));
+
+    std::ofstream(file, std::ios::binary) << "this is not a world snapshot at all";
+    EXPECT_FALSE(snapshot.open(file));
+
+    World world(40.0f, 40.0f);
+    std::vector<std::unique_ptr<Module>> modules;
+    modules.push_back(std::make_unique<LargeChargingStation>(false));
+    ASSERT_TRUE(WorldSnapshot::Write(file, world, modules));
+    std::filesystem::resize_file(file, std::filesystem::file_size(file) - 1);
+    EXPECT_FALSE(snapshot.open(file));
+    EXPECT_FALSE(snapshot.isOpen());
+}
+
+TEST_F(WorldSnapshotTests, RejectsParentCycles) {
+    World world(40.0f, 40.0f);
+    std::vector<std::unique_ptr<Module>> modules;
+    modules.push_back(std::make_unique<NormalRoad>());
+    modules.push_back(std::make_unique<SmallParking>(true));
+    modules.push_back(std::make_unique<NormalRoad>());
+    // 0 -> 2 -> 1 -> 0; anything walking up the parents would never stop
+    modules[0]->setParent(modules[2].get());
+    modules[2]->setParent(modules[1].get());
+    modules[1]->setParent(modules[0].get());
+    ASSERT_TRUE(WorldSnapshot::Write(file, world, modules));
+
+    WorldSnapshot snapshot;
+    EXPECT_FALSE(snapshot.open(file));
+    EXPECT_FALSE(WorldSnapshot::Load(file).has_value());
+}
@@ -0,0 +1,66 @@
+#include "core/AssetManifest.hpp"
+#include "core/AssetPack.hpp"
+#include "core/Logger.hpp"
+#include "raylib.h"
+#include <algorithm>
+#include <string>
+#include <vector>
+
+/**
+ * @file asset_packer.cpp
+ * @brief Build step: decodes every manifest texture and writes them into one asset pack.
+ *
+ * Usage: asset_packer <source dir> <output pack>
+ * Paths in the manifest are resolved against the source directory and stored as listed, so
+ * the game finds them under the same names it would otherwise load from disk.
+ */
+
+int main(int argc, char **argv) {
+  if (argc != 3) {
+    Logger::Error("Usage: {} <source dir> <output pack>", argc > 0 ? argv[0] : "asset_packer");
+    return 1;
+  }
+  std::string root = argv[1];
+  std::string output = argv[2];
+
+  SetTraceLogLevel(LOG_WARNING);
+
+  // One image per distinct path
+  std::vector<std::string> paths;
+  for (const auto &entry : AssetManifest::TEXTURES) {
+    if (std::find(paths.begin(), paths.end(), entry.path) == paths.end()) {
+      paths.emplace_back(entry.path);
+    }
+  }
+
+  std::vector<Image> images;
+  std::vector<AssetPack::Source> sources;
+  bool ok = true;
+  for (const auto &path : paths) {
+    Image image = LoadImage((root + "/" + path).c_str());
+    if (image.data == nullptr) {
+      Logger::Error("Failed to decode {}", path);
+      ok = false;
+      break;
+    }
+
+    // Stored ready for upload: no conversion at runtime
+    ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    auto bytes = static_cast<std::size_t>(GetPixelDataSize(image.width, image.height, image.format));
+    images.push_back(image);
+    sources.push_back({path, image.width, image.height, image.format,
+                       {static_cast<const unsigned char *>(image.data), bytes}});
+  }
+
+  if (ok) {
+    ok = AssetPack::Write(output, sources);
+  }
+  if (ok) {
+    Logger::Info("Packed {} images into {}", sources.size(), output);
+  }
+
+  for (Image &image : images) {
+    UnloadImage(image);
+  }
+  return ok ? 0 : 1;
+}